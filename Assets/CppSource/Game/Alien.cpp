@@ -6,66 +6,52 @@ using namespace UnityEngine;
 #include "Alien.h"
 #include "Game.h"
 
-// statics
-Sprite *Alien::AlienSprite = nullptr;
-bool Alien::LoadedResources = false;
-AudioClip *Alien::Sound = nullptr;
-
+//
+// the mixer's voice isn't tied to the GameObject, so stop it here
+//
 Alien::~Alien()
 {
-	mGo.GetComponent<AudioSource>().Stop();
+	if (mVoice != 0)
+	{
+		mGame->GetMixer().Stop(mVoice);
+	}
 }
 
 int Alien::Init()
 {
-	int ret = GameEntity::Init(GetName());
-	if (ret < 0)
+	int ret = 0;
+
+	const GameAssets &assets = mGame->GetAssets();
+	mSpeed = mGame->GetPlayerShip().GetSpeed() * 0.7f;
+
+	// start at upper right with the sound playing looped, on the mixer if
+	// it has the sound. otherwise the AudioSource plays it and it stops when
+	// the GameObject is destroyed
+	SetPosition(1.5f, 1.6f, 0.0f);
+	SetSprite(assets.Alien);
+	if (assets.AlienSample >= 0)
 	{
-		return ret;
+		mVoice = mGame->GetMixer().Play(assets.AlienSample, 1.0f, true);
+		Spawn(SpawnBatch::ArchetypeAlien);
 	}
-
-	// load Alien sprites once
-	if (LoadedResources == false)
+	else
 	{
-		AlienSprite = new Sprite;
-		*AlienSprite = Resources::Load<Sprite>(String("ufo"));
-		Sound = new AudioClip;
-		*Sound = Resources::Load<AudioClip>(String("Sounds\\saucerBig"));
-		LoadedResources = true;
+		Spawn(SpawnBatch::ArchetypeAlien, &assets.AlienSound);
 	}
 
-	mSpeed = Game::GetInstance()->GetPlayerShip().GetSpeed() * 0.7f;
-	mGo.AddComponent<SpriteRenderer>();
-	mGo.GetComponent<SpriteRenderer>().SetSprite(*AlienSprite);
-	mGo.AddComponent<AudioSource>();
-
-	// start at upper right
-	Vector3 startPos(1.5f, 1.6f, 0.0f);					
-	SetPosition(startPos);
-
-	// play sound looped
-	mGo.GetComponent<AudioSource>().SetClip(*Sound);		
-	mGo.GetComponent<AudioSource>().SetLoop(true);
-	mGo.GetComponent<AudioSource>().Play();
-
 	return ret;
 }
 
 //
 // Move object from right to left
 //
-void Alien::Update(float deltaTime)
+void Alien::Simulate(float deltaTime)
 {
-	//	Debug::Log(String("Alien Update"));
-	Vector3 &pos = GetPosition();
-	pos.x = pos.x - mSpeed * deltaTime;
-	SetPosition(pos);
+	SetPosition(mX - mSpeed * deltaTime, mY, mZ);
 
 	const float minX = -1.6f;
-	if (pos.x < minX)
+	if (mX < minX)
 	{	// off screen
-//		Debug::Log(String("Removing Alien"));
-		Game::GetInstance()->RemoveAlien();
+		Kill();
 	}
-
 }
@@ -10,19 +10,16 @@
 class Alien : public GameEntity
 {
 private:
-	static bool LoadedResources;
-	static Sprite *AlienSprite;
-	static AudioClip *Sound;
-
 	float mSpeed;
+	int32_t mVoice;		// looping on the mixer, or 0
 
 public:
 	static String GetName() { return String("Alien"); }
 
-	Alien() { }
+	Alien(Game *game) : GameEntity(game), mVoice(0) { }
 	virtual ~Alien();
 
 	int Init();
-	void Update(float deltaTime);
+	void Simulate(float deltaTime);
 };
 
@@ -0,0 +1,190 @@
+//
+// implementation for the memory mapped asset pack
+//
+
+#include "AssetPack.h"
+#include "Logger.h"
+#include <string.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(AssetPack::Header) == 64, "must match AssetPacker.cs");
+static_assert(sizeof(AssetPack::Section) == 64, "must match AssetPacker.cs");
+
+// the logger takes its arguments by reference
+const uint32_t AssetPack::Magic;
+const uint32_t AssetPack::Version;
+
+AssetPack::AssetPack()
+	: mData(nullptr)
+	, mSize(0)
+	, mSections(nullptr)
+	, mNumSections(0)
+#ifdef _WIN32
+	, mFile(INVALID_HANDLE_VALUE)
+	, mMapping(nullptr)
+#endif
+{
+}
+
+AssetPack::~AssetPack()
+{
+	Close();
+}
+
+//
+// map the whole pack read only. the OS is told it'll be read front to
+// back so startup costs one sequential read, not a seek per asset.
+// returns -1 if it isn't there or isn't a pack this build understands
+//
+int AssetPack::Open(const char *path)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return -1;
+	mFile = file;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		Close();
+		return -1;
+	}
+	mMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mMapping)
+	{
+		Close();
+		return -1;
+	}
+	mData = (const uint8_t *)MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+	mSize = (size_t)size.QuadPart;
+#else
+	int file = open(path, O_RDONLY);
+	if (file < 0)
+		return -1;
+
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0)
+	{
+		close(file);
+		return -1;
+	}
+	void *data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);	// the mapping keeps the file
+	if (data == MAP_FAILED)
+		return -1;
+	madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+	madvise(data, (size_t)info.st_size, MADV_WILLNEED);
+	mData = (const uint8_t *)data;
+	mSize = (size_t)info.st_size;
+#endif
+
+	if (!mData || Validate() != 0)
+	{
+		Close();
+		return -1;
+	}
+	return 0;
+}
+
+void AssetPack::Close()
+{
+#ifdef _WIN32
+	if (mData)
+		UnmapViewOfFile(mData);
+	if (mMapping)
+		CloseHandle(mMapping);
+	if (mFile != INVALID_HANDLE_VALUE)
+		CloseHandle(mFile);
+	mMapping = nullptr;
+	mFile = INVALID_HANDLE_VALUE;
+#else
+	if (mData)
+		munmap((void *)mData, mSize);
+#endif
+	mData = nullptr;
+	mSize = 0;
+	mSections = nullptr;
+	mNumSections = 0;
+}
+
+//
+// everything the accessors trust is checked once here, so a truncated or
+// stale pack is turned away rather than read past its end
+//
+int AssetPack::Validate()
+{
+	if (mSize < sizeof(Header))
+		return -1;
+
+	const Header *header = (const Header *)mData;
+	if (header->Magic != Magic)
+		return -1;
+	if (header->Version != Version)
+	{
+		LOG_WARNING("Asset pack is version ", header->Version, ", expected ", Version);
+		return -1;
+	}
+	if (header->FileSize != mSize || header->Alignment == 0
+		|| header->NumSections > (mSize - sizeof(Header)) / sizeof(Section))
+	{
+		LOG_WARNING("Asset pack is truncated or corrupt");
+		return -1;
+	}
+
+	mSections = (const Section *)(mData + sizeof(Header));
+	mNumSections = (int)header->NumSections;
+
+	int i;
+	for (i = 0; i < mNumSections; i++)
+	{
+		const Section &section = mSections[i];
+		uint64_t expected = 0;
+		switch (section.Type)
+		{
+		case TypeTexture:
+			expected = (uint64_t)section.Width * section.Height * 4;
+			break;
+		case TypeFrames:
+			expected = (uint64_t)section.Count * FrameWords * sizeof(float);
+			break;
+		case TypeSound:
+			expected = (uint64_t)section.Count * 2 * sizeof(float);
+			break;
+		}
+		if (section.Name[sizeof(section.Name) - 1] != 0
+			|| section.Offset % header->Alignment != 0
+			|| section.Offset > mSize || section.Size > mSize - section.Offset
+			|| section.Size != expected)
+		{
+			LOG_WARNING("Asset pack section ", i, " is corrupt");
+			return -1;
+		}
+	}
+	return 0;
+}
+
+//
+// the section of the given type and name, or nullptr
+//
+const AssetPack::Section *AssetPack::Find(SectionType type, const char *name) const
+{
+	int i;
+	for (i = 0; i < mNumSections; i++)
+	{
+		if (mSections[i].Type == (uint32_t)type && strcmp(mSections[i].Name, name) == 0)
+			return &mSections[i];
+	}
+	return nullptr;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+//
+// the asset pack made by AssetPacker.cs. one file of sections, each on its
+// own page, found through an index right after the header. the file is
+// mapped, not read, so textures upload and sounds mix straight out of it.
+// the layout must match AssetPacker.cs
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+class AssetPack
+{
+public:
+	static const uint32_t Magic = 0x4B415047;	// "GPAK"
+	static const uint32_t Version = 1;
+
+	enum SectionType
+	{
+		TypeTexture = 1,	// RGBA32 pixels, bottom row first
+		TypeFrames = 2,		// per frame float x, y, width, height in pixels, pivot x, pivot y, pixels per unit
+		TypeSound = 3,		// interleaved stereo floats
+	};
+
+	struct Header
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t NumSections;
+		uint32_t Alignment;		// of every section's offset
+		uint64_t FileSize;
+		uint8_t Pad[40];
+	};
+
+	struct Section
+	{
+		char Name[32];			// null terminated
+		uint32_t Type;
+		uint32_t Count;			// frames, or sound frames
+		uint32_t Width;			// texture width, or sound sample rate
+		uint32_t Height;		// texture height
+		uint64_t Offset;
+		uint64_t Size;
+	};
+
+	static const int FrameWords = 7;
+
+private:
+	const uint8_t *mData;
+	size_t mSize;
+	const Section *mSections;
+	int mNumSections;
+#ifdef _WIN32
+	void *mFile;
+	void *mMapping;
+#endif
+
+	int Validate();
+
+public:
+	AssetPack();
+	~AssetPack();
+
+	int Open(const char *path);
+	void Close();
+	bool IsOpen() const { return mData != nullptr; }
+
+	const Section *Find(SectionType type, const char *name) const;
+	const void *GetData(const Section &section) const { return mData + section.Offset; }
+};
@@ -0,0 +1,140 @@
+//
+// implementation for running batches of headless worlds
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "BatchRunner.h"
+#include "Logger.h"
+#include <chrono>
+#include <thread>
+
+BatchRunner::BatchRunner(int numWorkers)
+	: mLogFile(stdout)
+	, mMode(Game::ModeClassic)
+{
+	// the calling thread only flushes the log while it waits, the workers do the running
+	mJobs.Start(numWorkers > 0 ? numWorkers : 1);
+}
+
+//
+// one world per seed, all sharing source's loaded assets. blocks until
+// every world has run numFrames. results come back in seed order
+//
+void BatchRunner::Run(const Game &source, const std::vector<uint32_t> &seeds, int numFrames, float deltaTime,
+	const InputScript &script, std::vector<Result> &results)
+{
+	int numWorlds = (int)seeds.size();
+	results.resize(numWorlds);
+
+	// set up here, copying the assets takes wrapper references
+	std::vector<Game *> worlds(numWorlds);
+	std::vector<WavWriter> recorders(numWorlds);
+	int i;
+	for (i = 0; i < numWorlds; i++)
+	{
+		worlds[i] = new Game(true);
+		worlds[i]->SetMode(mMode);
+		worlds[i]->InitHeadless(source, seeds[i]);
+
+		if (!mAudioDirectory.empty())
+		{
+			Mixer &mixer = worlds[i]->GetMixer();
+			std::string path = mAudioDirectory + "/world" + std::to_string(i) + "_seed" + std::to_string(seeds[i]) + ".wav";
+			if (recorders[i].Open(path.c_str(), mixer.GetSampleRate()))
+			{
+				mixer.Record(&recorders[i]);
+			}
+			else
+			{
+				LOG_WARNING("Couldn't record world ", i, " to ", path.c_str());
+			}
+		}
+	}
+
+	JobSystem::Counter pending(0);
+	for (i = 0; i < numWorlds; i++)
+	{
+		mJobs.Submit([&, i]()
+		{
+			Game *world = worlds[i];
+			SpriteBatcher &sprites = world->GetSpriteBatcher();
+			int spriteErrors = 0;
+			double totalMs = 0;
+			double worstMs = 0;
+			int frame;
+			for (frame = 0; frame < numFrames; frame++)
+			{
+				PlayerInput input = script(*world, frame);
+				auto start = std::chrono::steady_clock::now();
+				world->Step(input, deltaTime);
+				double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+				totalMs += ms;
+				if (ms > worstMs)
+				{
+					worstMs = ms;
+				}
+				spriteErrors += sprites.Validate(sprites.GetLastFrame());
+			}
+
+			results[i].Seed = seeds[i];
+			results[i].Frames = numFrames;
+			results[i].Stats = world->GetStats();
+			results[i].SpriteErrors = spriteErrors;
+			results[i].MeanStepMs = numFrames > 0 ? (float)(totalMs / numFrames) : 0;
+			results[i].WorstStepMs = (float)worstMs;
+			LOG_INFO("World ", i, " seed ", seeds[i], " done, ", results[i].Stats.RocksDestroyed, " rocks ",
+				results[i].Stats.AliensDestroyed, " aliens ", results[i].Stats.ShipHits, " ship hits, ",
+				results[i].Stats.RocksSplit, " split, peak ", results[i].Stats.PeakRocks, " rocks, step ",
+				results[i].MeanStepMs, " ms mean ", results[i].WorstStepMs, " ms worst");
+		}, &pending);
+	}
+
+	// the workers run the worlds, this thread keeps their logging moving
+	while (pending.load() > 0)
+	{
+		Logger::GetInstance()->Flush(mLogFile);
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	mJobs.Wait(&pending);
+	Logger::GetInstance()->Flush(mLogFile);
+
+	for (i = 0; i < numWorlds; i++)
+	{
+		delete worlds[i];
+		recorders[i].Close();
+	}
+}
+
+//
+// fires constantly and sweeps the ship side to side, turning round every
+// sweepFrames, so rocks get shot and the ship gets hit
+//
+BatchRunner::InputScript BatchRunner::SweepScript(int sweepFrames)
+{
+	return [sweepFrames](const Game &, int frame)
+	{
+		bool left = (frame / sweepFrames) % 2 == 0;
+
+		PlayerInput input = {};
+		input.Fire = true;
+		input.Left = left;
+		input.Right = !left;
+		input.LeftPressed = left && frame % sweepFrames == 0;
+		input.RightPressed = !left && frame % sweepFrames == 0;
+		return input;
+	};
+}
+
+//
+// the stress scenario's input. fires constantly and sweeps the ship side to
+// side, so with ModeFragmentStress the field fills with fragments. a
+// benchmark run is this plus SetMode(Game::ModeFragmentStress), which is
+// what BatchHost --mode stress does
+//
+BatchRunner::InputScript BatchRunner::StressScript()
+{
+	return SweepScript(90);
+}
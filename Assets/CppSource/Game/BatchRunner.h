@@ -0,0 +1,50 @@
+#pragma once
+
+//
+// runs many independent headless worlds side by side, one job per world.
+// each gets its own random seed and scripted input, for tuning and soak
+// tests without a Unity frame per step
+//
+
+#include "Game.h"
+#include "JobSystem.h"
+#include <functional>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+class BatchRunner
+{
+public:
+	// input for one world on one frame. called from that world's job
+	typedef std::function<PlayerInput(const Game &world, int frame)> InputScript;
+
+	struct Result
+	{
+		uint32_t Seed;
+		int Frames;
+		Game::Stats Stats;
+		int SpriteErrors;	// bad quads or ranges the sprite batcher built
+		float MeanStepMs;	// simulate and build, per frame
+		float WorstStepMs;
+	};
+
+private:
+	JobSystem mJobs;
+	FILE *mLogFile;		// where the worlds' logging goes
+	std::string mAudioDirectory;	// each world's mix is recorded here, if set
+	Game::Mode mMode;
+
+public:
+	explicit BatchRunner(int numWorkers);
+
+	void SetLogFile(FILE *file) { mLogFile = file; }
+	void SetAudioDirectory(const std::string &directory) { mAudioDirectory = directory; }
+	void SetMode(Game::Mode mode) { mMode = mode; }
+
+	static InputScript SweepScript(int sweepFrames);
+	static InputScript StressScript();
+
+	void Run(const Game &source, const std::vector<uint32_t> &seeds, int numFrames, float deltaTime,
+		const InputScript &script, std::vector<Result> &results);
+};
@@ -0,0 +1,81 @@
+//
+// implementation for the collision broadphase grid
+//
+
+#include "CollisionGrid.h"
+
+CollisionGrid::CollisionGrid(float minX, float minY, float maxX, float maxY, float cellSize)
+	: mMinX(minX)
+	, mMinY(minY)
+	, mCellSize(cellSize)
+	, mNumCellsX((int)((maxX - minX) / cellSize) + 1)
+	, mNumCellsY((int)((maxY - minY) / cellSize) + 1)
+{
+	mCellStart.assign(mNumCellsX * mNumCellsY + 1, 0);
+}
+
+//
+// cell range a rect overlaps, clamped to the grid
+//
+void CollisionGrid::GetCells(const Rect &rect, int &x0, int &y0, int &x1, int &y1) const
+{
+	x0 = (int)((rect.mTopLeft.x - mMinX) / mCellSize);
+	x1 = (int)((rect.mBottomRight.x - mMinX) / mCellSize);
+	y0 = (int)((rect.mBottomRight.y - mMinY) / mCellSize);
+	y1 = (int)((rect.mTopLeft.y - mMinY) / mCellSize);
+
+	x0 = x0 < 0 ? 0 : (x0 >= mNumCellsX ? mNumCellsX - 1 : x0);
+	x1 = x1 < 0 ? 0 : (x1 >= mNumCellsX ? mNumCellsX - 1 : x1);
+	y0 = y0 < 0 ? 0 : (y0 >= mNumCellsY ? mNumCellsY - 1 : y0);
+	y1 = y1 < 0 ? 0 : (y1 >= mNumCellsY ? mNumCellsY - 1 : y1);
+}
+
+//
+// bin the live rects by cell. a counting sort, so entries in each cell stay
+// in index order
+//
+void CollisionGrid::Build(const std::vector<Rect> &rects, const std::vector<uint8_t> &live)
+{
+	int numCells = mNumCellsX * mNumCellsY;
+	mCellStart.assign(numCells + 1, 0);
+
+	int count = (int)rects.size();
+	int i, x, y;
+	int x0, y0, x1, y1;
+	for (i = 0; i < count; i++)
+	{
+		if (!live[i])
+			continue;
+
+		GetCells(rects[i], x0, y0, x1, y1);
+		for (y = y0; y <= y1; y++)
+		{
+			for (x = x0; x <= x1; x++)
+			{
+				mCellStart[y * mNumCellsX + x + 1]++;
+			}
+		}
+	}
+
+	for (i = 0; i < numCells; i++)
+	{
+		mCellStart[i + 1] += mCellStart[i];
+	}
+
+	mEntries.resize(mCellStart[numCells]);
+	mCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+	for (i = 0; i < count; i++)
+	{
+		if (!live[i])
+			continue;
+
+		GetCells(rects[i], x0, y0, x1, y1);
+		for (y = y0; y <= y1; y++)
+		{
+			for (x = x0; x <= x1; x++)
+			{
+				mEntries[mCursor[y * mNumCellsX + x]++] = i;
+			}
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+//
+// uniform grid broadphase. built once a frame from the rocks, then queried
+// from any number of jobs at once
+//
+
+#include "Rect.h"
+#include <stdint.h>
+#include <vector>
+
+class CollisionGrid
+{
+public:
+	typedef MyGame::Rectangle<float> Rect;
+
+private:
+	float mMinX, mMinY;		// anything outside the grid lands in the edge cells
+	float mCellSize;
+	int mNumCellsX, mNumCellsY;
+
+	std::vector<int32_t> mCellStart;	// first entry of each cell, plus one past the last
+	std::vector<int32_t> mEntries;		// rect indices grouped by cell
+	std::vector<int32_t> mCursor;		// scratch for Build
+
+	void GetCells(const Rect &rect, int &x0, int &y0, int &x1, int &y1) const;
+
+public:
+	CollisionGrid(float minX, float minY, float maxX, float maxY, float cellSize);
+
+	void Build(const std::vector<Rect> &rects, const std::vector<uint8_t> &live);
+	template<typename F> void Query(const Rect &rect, const F &fn) const;
+};
+
+//
+// call fn(index) for every rect sharing a cell with rect. a rect that
+// spans cells can be reported more than once
+//
+template<typename F>
+void CollisionGrid::Query(const Rect &rect, const F &fn) const
+{
+	int x0, y0, x1, y1;
+	GetCells(rect, x0, y0, x1, y1);
+
+	int x, y;
+	for (y = y0; y <= y1; y++)
+	{
+		for (x = x0; x <= x1; x++)
+		{
+			int cell = y * mNumCellsX + x;
+			int i;
+			for (i = mCellStart[cell]; i < mCellStart[cell + 1]; i++)
+			{
+				fn(mEntries[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,160 @@
+//
+// implementation for the simulation to Unity command ring
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "CommandQueue.h"
+#include "FrameCommands.h"
+#include <assert.h>
+#include <thread>
+
+CommandQueue::CommandQueue(uint32_t capacity)
+	: mRing(capacity)
+	, mMask(capacity - 1)
+	, mDiscard(false)
+	, mHead(0)
+	, mTail(0)
+{
+	assert((capacity & mMask) == 0);
+}
+
+//
+// claim the next entry. if the ring is full, wait for the main thread to
+// drain some
+//
+CommandQueue::Command &CommandQueue::Begin(int32_t type, int32_t slot)
+{
+	if (mDiscard)
+		return mScratch;
+
+	uint32_t head = mHead.load(std::memory_order_relaxed);
+	while (head - mTail.load(std::memory_order_acquire) == mRing.size())
+	{
+		std::this_thread::yield();
+	}
+
+	Command &cmd = mRing[head & mMask];
+	cmd.Type = type;
+	cmd.Slot = slot;
+	return cmd;
+}
+
+//
+// publish the entry claimed by Begin
+//
+void CommandQueue::End()
+{
+	if (mDiscard)
+		return;
+
+	mHead.store(mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void CommandQueue::Spawn(int32_t slot, SpawnBatch::Archetype archetype, float x, float y, float z,
+	int32_t sprite, const AudioClip *clip)
+{
+	Command &cmd = Begin(TypeSpawn, slot);
+	cmd.Spawn.Archetype = archetype;
+	cmd.Spawn.X = x;
+	cmd.Spawn.Y = y;
+	cmd.Spawn.Z = z;
+	cmd.Spawn.Sprite = sprite;
+	cmd.Spawn.Clip = clip ? clip->Handle : 0;
+	End();
+}
+
+void CommandQueue::SetPosition(int32_t slot, float x, float y, float z)
+{
+	Command &cmd = Begin(TypeSetPosition, slot);
+	cmd.Position.X = x;
+	cmd.Position.Y = y;
+	cmd.Position.Z = z;
+	End();
+}
+
+void CommandQueue::SetSprite(int32_t slot, int32_t sprite)
+{
+	Command &cmd = Begin(TypeSetSprite, slot);
+	cmd.Sprite = sprite;
+	End();
+}
+
+void CommandQueue::PlayOneShot(int32_t slot, int32_t clip)
+{
+	Command &cmd = Begin(TypePlayOneShot, slot);
+	cmd.Clip = clip;
+	End();
+}
+
+void CommandQueue::Destroy(int32_t slot)
+{
+	Begin(TypeDestroy, slot);
+	End();
+}
+
+//
+// the frame must stay untouched until the main thread has flushed it
+//
+void CommandQueue::DrawSprites(const SpriteBatcher::Frame &frame)
+{
+	Command &cmd = Begin(TypeDrawSprites, -1);
+	cmd.Sprites = &frame;
+	End();
+}
+
+//
+// everything pushed since the last EndFrame belongs to one frame
+//
+void CommandQueue::EndFrame()
+{
+	Begin(TypeEndFrame, -1);
+	End();
+}
+
+//
+// main thread. move what's been pushed into frame, stopping after an end of
+// frame. returns true once frame holds a whole frame
+//
+bool CommandQueue::Drain(FrameCommands &frame)
+{
+	uint32_t tail = mTail.load(std::memory_order_relaxed);
+	uint32_t head = mHead.load(std::memory_order_acquire);
+	bool frameDone = false;
+
+	while (tail != head && !frameDone)
+	{
+		const Command &cmd = mRing[tail & mMask];
+		switch (cmd.Type)
+		{
+		case TypeSpawn:
+			frame.Spawn(cmd.Slot, (SpawnBatch::Archetype)cmd.Spawn.Archetype,
+				cmd.Spawn.X, cmd.Spawn.Y, cmd.Spawn.Z, cmd.Spawn.Sprite, cmd.Spawn.Clip);
+			break;
+		case TypeSetPosition:
+			frame.SetPosition(cmd.Slot, cmd.Position.X, cmd.Position.Y, cmd.Position.Z);
+			break;
+		case TypeSetSprite:
+			frame.SetSprite(cmd.Slot, cmd.Sprite);
+			break;
+		case TypePlayOneShot:
+			frame.PlayOneShot(cmd.Slot, cmd.Clip);
+			break;
+		case TypeDestroy:
+			frame.Destroy(cmd.Slot);
+			break;
+		case TypeDrawSprites:
+			frame.DrawSprites(cmd.Sprites);
+			break;
+		case TypeEndFrame:
+			frameDone = true;
+			break;
+		}
+		tail++;
+	}
+
+	mTail.store(tail, std::memory_order_release);
+	return frameDone;
+}
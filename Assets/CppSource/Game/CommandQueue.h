@@ -0,0 +1,87 @@
+#pragma once
+
+//
+// lock free single producer, single consumer ring of engine commands. the
+// simulation pushes them from its job, the main thread drains them a frame
+// at a time into a FrameCommands and flushes that to Unity
+//
+
+#include "Bindings.h"
+#include "SpawnBatch.h"
+#include "SpriteBatcher.h"
+#include <atomic>
+#include <vector>
+
+class FrameCommands;
+class CommandQueue
+{
+public:
+	enum Type
+	{
+		TypeSpawn,
+		TypeSetPosition,
+		TypeSetSprite,
+		TypePlayOneShot,
+		TypeDestroy,
+		TypeDrawSprites,
+		TypeEndFrame
+	};
+
+	struct SpawnArgs
+	{
+		int32_t Archetype;
+		float X, Y, Z;
+		int32_t Sprite;
+		int32_t Clip;		// object store handle, 0 for none
+	};
+
+	struct PositionArgs
+	{
+		float X, Y, Z;
+	};
+
+	// 32 bytes, two to a cache line
+	struct Command
+	{
+		int32_t Type;
+		int32_t Slot;
+		union
+		{
+			SpawnArgs Spawn;
+			PositionArgs Position;
+			int32_t Sprite;
+			int32_t Clip;
+			const SpriteBatcher::Frame *Sprites;
+		};
+	};
+
+private:
+	std::vector<Command> mRing;
+	uint32_t mMask;
+	bool mDiscard;			// nobody drains, commands are dropped as they're pushed
+	Command mScratch;		// what dropped commands are written into
+
+	// each written by one side only. kept apart so they don't share a line
+	alignas(64) std::atomic<uint32_t> mHead;	// next to write, producer side
+	alignas(64) std::atomic<uint32_t> mTail;	// next to read, consumer side
+
+	Command &Begin(int32_t type, int32_t slot);
+	void End();
+
+public:
+	explicit CommandQueue(uint32_t capacity);	// power of two
+	void SetDiscard(bool discard) { mDiscard = discard; }
+
+	// producer side
+	void Spawn(int32_t slot, SpawnBatch::Archetype archetype, float x, float y, float z,
+		int32_t sprite, const UnityEngine::AudioClip *clip = nullptr);
+	void SetPosition(int32_t slot, float x, float y, float z);
+	void SetSprite(int32_t slot, int32_t sprite);
+	void PlayOneShot(int32_t slot, int32_t clip);
+	void Destroy(int32_t slot);
+	void DrawSprites(const SpriteBatcher::Frame &frame);
+	void EndFrame();
+
+	// consumer side
+	bool Drain(FrameCommands &frame);
+};
@@ -0,0 +1,76 @@
+//
+// implementation for a frame's worth of queued Unity work
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "FrameCommands.h"
+
+void FrameCommands::Spawn(int32_t slot, SpawnBatch::Archetype archetype, float x, float y, float z,
+	int32_t sprite, int32_t clip)
+{
+	mSpawns.Add(slot, archetype, x, y, z, sprite, clip);
+}
+
+void FrameCommands::SetPosition(int32_t slot, float x, float y, float z)
+{
+	mTransforms.SetPosition(slot, x, y, z);
+}
+
+void FrameCommands::SetSprite(int32_t slot, int32_t sprite)
+{
+	SpriteTable::Command cmd;
+	cmd.Slot = slot;
+	cmd.Sprite = sprite;
+	mSprites.push_back(cmd);
+}
+
+void FrameCommands::PlayOneShot(int32_t slot, int32_t clip)
+{
+	SoundCommand cmd;
+	cmd.Slot = slot;
+	cmd.Clip = clip;
+	mSounds.push_back(cmd);
+}
+
+void FrameCommands::Destroy(int32_t slot)
+{
+	mDestroys.push_back(slot);
+}
+
+//
+// main thread. one call per kind of command. spawns go first and destroys
+// last, so an object made and killed in the same frame is still created
+// before it's destroyed
+//
+void FrameCommands::Flush()
+{
+	mSpawns.Flush();
+	mTransforms.Flush();
+
+	if (!mSprites.empty())
+	{
+		MyGame::NativeBatch::SetSprites(mSprites.data(), (int)mSprites.size());
+		mSprites.clear();
+	}
+
+	if (mSpriteFrame)
+	{
+		MyGame::NativeBatch::DrawSprites((void *)mSpriteFrame->GetLayers(), SpriteBatcher::NumLayers);
+		mSpriteFrame = nullptr;
+	}
+
+	if (!mSounds.empty())
+	{
+		MyGame::NativeBatch::PlayOneShots(mSounds.data(), (int)mSounds.size());
+		mSounds.clear();
+	}
+
+	if (!mDestroys.empty())
+	{
+		MyGame::NativeBatch::Destroy(mDestroys.data(), (int)mDestroys.size());
+		mDestroys.clear();
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+//
+// everything one simulated frame wants Unity to do, staged on the main
+// thread from the CommandQueue and sent with one call per kind
+//
+
+#include "Bindings.h"
+#include "SpawnBatch.h"
+#include "SpriteTable.h"
+#include "SpriteBatcher.h"
+#include "TransformBuffer.h"
+#include <vector>
+
+class FrameCommands
+{
+public:
+	// one PlayOneShot as Unity reads it. Must match NativeBatch.cs
+	struct SoundCommand
+	{
+		int32_t Slot;		// object slot with an AudioSource
+		int32_t Clip;		// object store handle
+	};
+
+private:
+	SpawnBatch mSpawns;
+	TransformBuffer mTransforms;
+	std::vector<SpriteTable::Command> mSprites;
+	std::vector<SoundCommand> mSounds;
+	std::vector<int32_t> mDestroys;
+	const SpriteBatcher::Frame *mSpriteFrame;	// layers to draw, if any
+
+public:
+	FrameCommands() : mSpriteFrame(nullptr) {}
+
+	void Spawn(int32_t slot, SpawnBatch::Archetype archetype, float x, float y, float z,
+		int32_t sprite, int32_t clip);
+	void SetPosition(int32_t slot, float x, float y, float z);
+	void SetSprite(int32_t slot, int32_t sprite);
+	void PlayOneShot(int32_t slot, int32_t clip);
+	void Destroy(int32_t slot);
+	void DrawSprites(const SpriteBatcher::Frame *frame) { mSpriteFrame = frame; }
+
+	void Flush();
+};
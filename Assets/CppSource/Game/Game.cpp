@@ -4,72 +4,381 @@ using namespace UnityEngine;
 
 #include "Game.h"
 #include "Rock.h"
-#include "Explosion.h"
 #include "Alien.h"
+#include "Missile.h"
 #include <Windows.h>	// for timeGetTime
+#include <algorithm>
 #include <assert.h>
+#include <thread>
+
+// for timeGetTime() usage
+#pragma comment(lib, "winmm.lib")
+
+//
+// a headless world has nothing to drain its commands, so they go nowhere
+//
+Game::Game(bool headless)
+	: GameEntity(this)
+	, mSpriteBatcher(mSpriteTable)
+	, mCommands(headless ? 1 : CommandCapacity)
+	, mSimPending(0)
+	, mSimRunning(false)
+	, mHeadless(headless)
+	, mNextSlot(0)
+	, mRockClip(-1)
+	, mVoices(MaxVoices)
+	, mMixer(44100)		// until Unity's output rate is known
+	, mStreaming(false)
+	, mPlayerShip(this)
+	, mBackground(this)
+	, mFlashEmitter(-1)
+	, mDebrisEmitter(-1)
+	, mAlien(nullptr)
+	, mRockGrid(-2.0f, -2.5f, 2.0f, 2.5f, 0.5f)	// covers the play area, 0.5 is about a rock
+{
+	mCommands.SetDiscard(headless);
+	mVoices.SetMixer(&mMixer);
+	mMode = ModeClassic;
+	ResetStats();
+
+	// everything counts as visible until the camera is known
+	mViewRect.mTopLeft = MyGame::Point<float>(-1.0e6f, 1.0e6f);
+	mViewRect.mBottomRight = MyGame::Point<float>(1.0e6f, -1.0e6f);
+}
+
+//
+// the last simulated frame may still be running on a job
+//
+Game::~Game()
+{
+	mJobs.Wait(&mSimPending);
+
+	// the audio thread must be done with the ring before it goes
+	if (mStreaming)
+	{
+		MyGame::NativeBatch::SetAudioStream(nullptr, 0);
+		mStreaming = false;
+	}
+
+	int i;
+	for (i = 0; i < mRocks.size(); i++)
+	{
+		delete mRocks[i];
+	}
+	for (i = 0; i < mRockPool.size(); i++)
+	{
+		delete mRockPool[i];
+	}
+	delete mAlien;
+
+	// the base class can't queue this once the members are gone
+	if (mGo != nullptr)
+	{
+		DestroyObject(mGo);
+		mGo = nullptr;
+	}
+	FlushDeadObjects();
+}
 
 int Game::Init()
 {
-	int ret = GameEntity::Init(GetName());
+	String name = GetName();
+	int ret = GameEntity::Init(name);
 	if (ret<0)
 	{
 		return ret;
 	}
 
-	int curTime = timeGetTime();
-	mLastRockTime = curTime;
-	mLastUpdateTime = curTime;
-	mLastAlienTime = curTime;
 	mDeltaTime = 0;
 	mAlien = nullptr;
+	mLoadPercent = -1;
+
+	// leave the main thread a core of its own. the simulation always needs
+	// a worker, the main thread only drains its commands while it waits
+	int numWorkers = (int)std::thread::hardware_concurrency() - 1;
+	mJobs.Start(numWorkers > 0 ? numWorkers : 1);
+
+	SpawnBatch::RegisterArchetypes();
+
+	// start loading everything. gameplay starts from Update once it's all in
+	ret = mAssets.BeginLoad();
+	if (ret != 0)
+		return ret;
 
 	// attach main game script to Game object
 	mGo.AddComponent<MyGame::BaseGameScript>();
-	
+
+	return ret;
+}
+
+//
+// a headless world that loads everything from an asset pack itself, with
+// no Unity at all. it doesn't play, it's the source other headless worlds
+// copy from, so a batch can run outside the editor
+//
+int Game::LoadHeadless(const char *packPath)
+{
+	assert(mHeadless);
+
+	int ret = mAssets.LoadHeadless(packPath, mSpriteTable);
+	if (ret != 0)
+		return ret;
+
+	// what the boot scene camera sees of z 0, 60 degrees across from 3.3
+	// back, at the default 1200x1800
+	mViewRect.mTopLeft = MyGame::Point<float>(-1.27f, 1.905f);
+	mViewRect.mBottomRight = MyGame::Point<float>(1.27f, -1.905f);
+
+	// at the pack's own rate the mixer plays them in place
+	mMixer.SetSampleRate(mAssets.GetPackSampleRate());
+	return mAssets.LoadSamples(mMixer);
+}
+
+//
+// a world with no Unity side, for batch runs. takes the loaded assets and
+// sprite bounds from source and its own random seed, then starts gameplay
+// straight away
+//
+int Game::InitHeadless(const Game &source, uint32_t seed)
+{
+	assert(mHeadless && source.mAssets.IsLoaded());
+
+	mDeltaTime = 0;
+	mLoadPercent = 100;
+	mRandom.seed(seed);
+
+	mAssets = source.mAssets;
+	mSpriteTable = source.mSpriteTable;
+	mViewRect = source.mViewRect;
+	mMixer.ShareSounds(source.mMixer);
+
+	return StartGameplay();
+}
+
+//
+// poll the preload and report progress. starts gameplay once assets are warm
+//
+void Game::UpdateLoading()
+{
+	float progress = mAssets.Poll();
+
+	int percent = (int)(progress * 100);
+	if (percent / 10 != mLoadPercent / 10)
+	{
+		LOG_INFO("Loading ", percent, "%");
+	}
+	mLoadPercent = percent;
+
+	if (mAssets.IsLoaded())
+	{
+		mSpriteTable.LoadBounds(mAssets.GetNumSprites());
+		mSpriteTable.LoadUVs(mAssets.GetNumSprites());
+
+		float view[4];		// min x, min y, max x, max y
+		MyGame::NativeBatch::GetViewRect(view);
+		mViewRect.mTopLeft = MyGame::Point<float>(view[0], view[3]);
+		mViewRect.mBottomRight = MyGame::Point<float>(view[2], view[1]);
+
+		LoadSounds();
+		StartGameplay();
+	}
+}
+
+//
+// decode the sound effects for the mixer and have Unity pull its stream.
+// if any of them can't be read the AudioSources play everything instead
+//
+void Game::LoadSounds()
+{
+	mMixer.SetSampleRate(MyGame::NativeBatch::GetOutputSampleRate());
+	if (mAssets.LoadSamples(mMixer) != 0)
+	{
+		LOG_WARNING("Sound files not found, falling back to AudioSources");
+		return;
+	}
+
+	MyGame::NativeBatch::SetAudioStream(mMixer.GetRing(), Mixer::RingFrames);
+	mStreaming = true;
+}
+
+//
+// bring up the background and ship and start the spawn timers
+//
+int Game::StartGameplay()
+{
+	mLastUpdateTime = timeGetTime();
+
 	// add background image
-	String bgSpritePath = { "background600x1024" };
-	mBGSprite = Resources::Load<Sprite>(bgSpritePath);
-	mGo.AddComponent<SpriteRenderer>();
-	mGo.GetComponent<SpriteRenderer>().SetSprite(mBGSprite);
-	mGo.GetTransform().SetPosition(Vector3(0, 0, 5));	// move back in Z
+	mBackground.SetPosition(0, 0, 5);	// move back in Z
+	mBackground.SetSprite(mAssets.Background);
+	mBackground.Spawn(SpawnBatch::ArchetypeBackground);
+	mStarfield.Init(mViewRect, mAssets.Star, 4);
 
-	ret = mPlayerShip.Init();
+	int ret = mPlayerShip.Init();
 	if (ret != 0)
 		return ret;
 
+	AddEmitters();
+	AddAnimations();
+	AddVoiceClips();
+	mScheduler.Start(SpawnRocks());
+	mScheduler.Start(RollForAliens());
+
+	if (mHeadless)
+		return ret;
+
+	// nothing is simulating yet, so background and ship come up right away
+	mCommands.EndFrame();
+	mCommands.Drain(mStaged);
+	mStaged.Flush();
+
 	return ret;
 }
 
 //
-// every 3 secs, if there is no alien roll die to add an alien
+// rocks tumble through their frames forever
 //
-void Game::CheckToAddAlien()
+void Game::AddAnimations()
 {
-	const float timeBetweenAliens = 3.0f;
+	mAnimator.Clear();
 
-	int curTime = timeGetTime();
+	SpriteAnimator::Clip rock = { mAssets.RockFrames, GameAssets::NumRockFrames, 10.0f, true };
+	mRockClip = mAnimator.AddClip(rock);
+}
 
-	// if already showing an alien, then don't do anything
-	if (mAlien != nullptr)
+//
+// an explosion is one particle playing the explosion frames, plus a spray
+// of small tumbling rock fragments
+//
+void Game::AddEmitters()
+{
+	mParticles.Clear();
+
+	ParticleSystem::Emitter flash;
+	flash.Count = 1;
+	flash.FirstSprite = mAssets.ExplosionFrames;
+	flash.NumSprites = GameAssets::NumExplosionFrames;
+	flash.MinFrameRate = flash.MaxFrameRate = 100.0f;
+	flash.Loop = false;
+	flash.MinLife = flash.MaxLife = GameAssets::NumExplosionFrames / 100.0f;
+	flash.MinSpeed = flash.MaxSpeed = 0;
+	flash.Drag = 0;
+	flash.Scale = 1.0f;
+	flash.Layer = SpriteBatcher::LayerExplosions;
+	mFlashEmitter = mParticles.AddEmitter(flash);
+
+	ParticleSystem::Emitter debris;
+	debris.Count = 32;
+	debris.FirstSprite = mAssets.RockFrames;
+	debris.NumSprites = GameAssets::NumRockFrames;
+	debris.MinFrameRate = 10.0f;
+	debris.MaxFrameRate = 30.0f;
+	debris.Loop = true;
+	debris.MinLife = 0.4f;
+	debris.MaxLife = 0.9f;
+	debris.MinSpeed = 0.5f;
+	debris.MaxSpeed = 2.0f;
+	debris.Drag = 1.5f;
+	debris.Scale = 0.2f;
+	debris.Layer = SpriteBatcher::LayerExplosions;
+	mDebrisEmitter = mParticles.AddEmitter(debris);
+}
+
+//
+// the ship's death always gets a voice, a chain of rock explosions can't
+// drown out everything else, and rapid fire only overlaps so much
+//
+void Game::AddVoiceClips()
+{
+	mVoices.Clear();
+
+	VoiceManager::ClipDesc playerExplosion = { mAssets.PlayerExplosionSound.Handle, 3, 1, mAssets.PlayerExplosionLength, mAssets.PlayerExplosionSample };
+	VoiceManager::ClipDesc rockExplosion = { mAssets.RockExplosionSound.Handle, 2, 4, mAssets.RockExplosionLength, mAssets.RockExplosionSample };
+	VoiceManager::ClipDesc fire = { mAssets.FireSound.Handle, 1, 3, mAssets.FireLength, mAssets.FireSample };
+	mVoices.AddClip(playerExplosion);
+	mVoices.AddClip(rockExplosion);
+	mVoices.AddClip(fire);
+}
+
+//
+// a new rock every second, or fifty a second under stress
+//
+Scheduler::Task Game::SpawnRocks()
+{
+	const float timeBetweenRocks = (mMode == ModeFragmentStress) ? 0.02f : 1.0f;
+
+	for (;;)
 	{
-		mLastAlienTime = curTime;
+		co_await mScheduler.Wait(timeBetweenRocks);
+
+		Rock *rock = NewRock();
+		rock->Init();
+		mRocks.push_back(rock);
+	}
+}
+
+//
+// a dead rock from the pool if there is one. the caller inits it
+//
+Rock *Game::NewRock()
+{
+	if (mRockPool.empty())
+		return new Rock(this);
+
+	Rock *rock = mRockPool.back();
+	mRockPool.pop_back();
+	return rock;
+}
+
+//
+// in the fragment modes a rock that's shot breaks into 2 to 4 smaller,
+// faster ones, thrown out evenly spaced from a random start. they join
+// the broadphase next frame
+//
+void Game::SplitRock(const Rock &rock)
+{
+	int size = rock.GetSize() + 1;
+	if (mMode == ModeClassic || size >= Rock::NumSizes)
 		return;
+
+	const float twoPi = 6.2831853f;
+	int count = 2 + Rand() % 3;
+	float angle = ((float)Rand() / RAND_MAX) * twoPi;
+	int i;
+	for (i = 0; i < count; i++)
+	{
+		Rock *fragment = NewRock();
+		fragment->InitFragment(rock, size, angle + i * twoPi / count);
+		mRocks.push_back(fragment);
 	}
+	mStats.RocksSplit++;
+}
+
+//
+// every 3 secs without an alien, roll die to add an alien
+//
+Scheduler::Task Game::RollForAliens()
+{
+	const float timeBetweenAliens = 3.0f;
 
-	if (curTime - mLastAlienTime > timeBetweenAliens * 1000)
+	for (;;)
 	{
-		mLastAlienTime = curTime;
+		// if already showing an alien, then don't do anything
+		while (mAlien != nullptr)
+		{
+			co_await mScheduler.NextFrame();
+		}
 
-		if ((rand() % 2) == 1)
+		co_await mScheduler.Wait(timeBetweenAliens);
+		if ((Rand() % 2) == 1)
 		{
-//			Debug::Log(String("Adding Alien"));
+			LOG_DEBUG("Adding Alien");
 			AddAlien();
 		}
-		//else
-		//{
-		//	Debug::Log(String("Not Adding Alien"));
-		//}
+		else
+		{
+			LOG_DEBUG("Not Adding Alien");
+		}
 	}
 }
 
@@ -79,114 +388,518 @@ void Game::CheckToAddAlien()
 int Game::AddAlien()
 {
 	delete mAlien;
-	mAlien = new Alien();
+	mAlien = new Alien(this);
 	return mAlien->Init();
 }
 
 //
 // Add an explosion into the scene at the given position
 //
-int Game::AddExplosion(Vector3 &pos)
+int Game::AddExplosion(float x, float y, float z)
 {
-	Explosion *explo = new Explosion();
-	int ret = explo->Init(pos);
-	mExplosions.push_back(explo);
-	return ret;
+	mParticles.Emit(mFlashEmitter, x, y, z, mRandom);
+	mParticles.Emit(mDebrisEmitter, x, y, z, mRandom);
+	return 0;
 }
 
-bool Game::RemoveRock(Rock *rock)
+void Game::RemoveAlien()
 {
+	delete mAlien;
+	mAlien = nullptr;
+}
+
+//
+// hand out a free object slot. slots freed last frame are back in the pool
+//
+int32_t Game::AllocSlot()
+{
+	if (mFreeSlots.empty())
+	{
+		return mNextSlot++;
+	}
+	int32_t slot = mFreeSlots.back();
+	mFreeSlots.pop_back();
+	return slot;
+}
+
+//
+// queue the slot's GameObject for destruction. the slot can't be reused
+// until that Destroy has been flushed, so it waits out the frame
+//
+void Game::DestroySlot(int32_t slot)
+{
+	GetCommands().Destroy(slot);
+	mReleasedSlots.push_back(slot);
+}
+
+//
+// main thread. the object is kept alive here until FlushDeadObjects
+//
+void Game::DestroyObject(const GameObject &go)
+{
+	mDeadObjects.push_back(go);
+}
+
+//
+// main thread. everything from DestroyObject in one call
+//
+void Game::FlushDeadObjects()
+{
+	if (mDeadObjects.empty())
+		return;
+
+	mDeadHandles.clear();
+	int i;
+	for (i = 0; i < mDeadObjects.size(); i++)
+	{
+		mDeadHandles.push_back(mDeadObjects[i].Handle);
+	}
+	MyGame::NativeBatch::DestroyMany(mDeadHandles.data(), (int)mDeadHandles.size());
+	mDeadObjects.clear();
+}
+
+//
+// main thread, with no frame simulating. take down everything gameplay
+// made and start over. every slot goes in the one Destroy call of the
+// frame StartGameplay flushes, everything else in one DestroyMany
+//
+void Game::ResetLevel()
+{
+	LOG_INFO("Level reset");
+
+	// the frame in hand still spawns things, make them so they can go
+	mStaged.Flush();
+
+	mScheduler.Clear();
+
 	int i;
 	for (i = 0; i < mRocks.size(); i++)
 	{
-		if (mRocks[i] == rock)
-		{
-			mRocks.erase(mRocks.begin() + i);
-			delete rock;
-			//Debug::Log(String("removing rock"));
-			return true;
-		}
+		delete mRocks[i];
 	}
+	mRocks.clear();
+	RemoveAlien();
+	mMixer.StopAll();
+	mPlayerShip.RemoveAllMissiles();
+	mPlayerShip.Despawn();
+	mBackground.Despawn();
 
-	assert(false);
-	return false;
+	ResetStats();
+
+	FlushDeadObjects();
+	StartGameplay();
 }
 
-void Game::RemoveAlien()
+void Game::ResetStats()
 {
-	delete mAlien;
-	mAlien = nullptr;
+	mStats.RocksDestroyed = 0;
+	mStats.AliensDestroyed = 0;
+	mStats.ShipHits = 0;
+	mStats.RocksSplit = 0;
+	mStats.PeakRocks = 0;
+}
+
+//
+// move and animate everything across the job threads. nothing in here
+// may call into Unity
+//
+void Game::SimulateEntities(float deltaTime)
+{
+	mJobs.ParallelFor((int)mRocks.size(), 16, [&](int begin, int end)
+	{
+		int i;
+		for (i = begin; i < end; i++)
+		{
+			mRocks[i]->Simulate(deltaTime);
+		}
+	});
+
+	std::vector<Missile *> &missiles = mPlayerShip.GetMissiles();
+	mJobs.ParallelFor((int)missiles.size(), 16, [&](int begin, int end)
+	{
+		int i;
+		for (i = begin; i < end; i++)
+		{
+			missiles[i]->Simulate(deltaTime);
+		}
+	});
+
+	if (mAlien)
+	{
+		mAlien->Simulate(deltaTime);
+	}
+
+	mParticles.Update(deltaTime);
+	mStarfield.Update(deltaTime);
 }
 
-void Game::UpdateAlien(float deltaTime)
+//
+// flag what the camera can see, so Apply skips the rest, and kill anything
+// that has left through the side it was heading for. entities still coming
+// in from off screen just sleep
+//
+void Game::CullEntities()
 {
+	const MyGame::Rectangle<float> &view = mViewRect;
+
+	mJobs.ParallelFor((int)mRocks.size(), 64, [&](int begin, int end)
+	{
+		int i;
+		for (i = begin; i < end; i++)
+		{
+			Rock *rock = mRocks[i];
+			MyGame::Rectangle<float> rect = rock->GetRect(1.0f);
+			rock->SetVisible(rect.Intersect(view));
+			if ((rect.mTopLeft.y < view.mBottomRight.y && rock->GetVY() <= 0)
+				|| (rect.mBottomRight.y > view.mTopLeft.y && rock->GetVY() > 0)
+				|| (rect.mBottomRight.x < view.mTopLeft.x && rock->GetVX() < 0)
+				|| (rect.mTopLeft.x > view.mBottomRight.x && rock->GetVX() > 0))
+			{	// out past the side it's moving towards
+				rock->Kill();
+			}
+		}
+	});
+
+	std::vector<Missile *> &missiles = mPlayerShip.GetMissiles();
+	int i;
+	for (i = 0; i < missiles.size(); i++)
+	{
+		MyGame::Rectangle<float> rect = missiles[i]->GetRect(1.0f);
+		missiles[i]->SetVisible(rect.Intersect(view));
+		if (rect.mBottomRight.y > view.mTopLeft.y)
+		{	// above the view
+			missiles[i]->Kill();
+		}
+	}
+
 	if (mAlien)
 	{
-		mAlien->Update(deltaTime);
+		MyGame::Rectangle<float> rect = mAlien->GetRect(1.0f);
+		mAlien->SetVisible(rect.Intersect(view));
+		if (rect.mBottomRight.x < view.mTopLeft.x)
+		{	// off the left
+			mAlien->Kill();
+		}
 	}
 }
 
-void Game::UpdateRocks(float deltaTime)
+//
+// broadphase and narrowphase in parallel, producing hit records. the records
+// are then sorted and resolved here, so the same frame always resolves the
+// same way however the jobs were split
+//
+void Game::CheckCollisions()
 {
+	std::vector<Missile *> &missiles = mPlayerShip.GetMissiles();
+	int numMissiles = (int)missiles.size();
+	int numRocks = (int)mRocks.size();
+
+	mRockRects.resize(numRocks);
+	mRockLive.resize(numRocks);
+	mJobs.ParallelFor(numRocks, 64, [&](int begin, int end)
+	{
+		int j;
+		for (j = begin; j < end; j++)
+		{
+			mRockLive[j] = !mRocks[j]->IsDead();
+			mRockRects[j] = mRocks[j]->GetRect(0.9f);
+		}
+	});
+	mRockGrid.Build(mRockRects, mRockLive);
+
+	bool alienLive = mAlien && !mAlien->IsDead();
+	MyGame::Rectangle<float> alienRect;
+	if (alienLive)
+		alienRect = mAlien->GetRect(1.0f);
+
+	// missiles against rocks and the alien
+	mMissileHits.clear();
+	mJobs.ParallelFor(numMissiles, 8, [&](int begin, int end)
+	{
+		std::vector<MissileHit> hits;
+		int i;
+		for (i = begin; i < end; i++)
+		{
+			if (missiles[i]->IsDead())
+				continue;
+
+			MyGame::Rectangle<float> missileRect = missiles[i]->GetRect(1.0f);
+			mRockGrid.Query(missileRect, [&](int32_t j)
+			{
+				if (mRockRects[j].Intersect(missileRect))
+				{
+					MissileHit hit = { i, j };
+					hits.push_back(hit);
+				}
+			});
+
+			if (alienLive && alienRect.Intersect(missileRect))
+			{
+				MissileHit hit = { i, HitAlien };
+				hits.push_back(hit);
+			}
+		}
+
+		if (!hits.empty())
+		{
+			std::lock_guard<std::mutex> lock(mHitsLock);
+			mMissileHits.insert(mMissileHits.end(), hits.begin(), hits.end());
+		}
+	});
+
+	// rocks against the ship. one query, not worth a job
+	MyGame::Rectangle<float> shipRect = mPlayerShip.GetRect(0.5f);
+	mShipHits.clear();
+	mRockGrid.Query(shipRect, [&](int32_t j)
+	{
+		if (mRockRects[j].Intersect(shipRect))
+		{
+			mShipHits.push_back(j);
+		}
+	});
+
+	// canonical order. rocks spanning grid cells are reported once per cell
+	std::sort(mMissileHits.begin(), mMissileHits.end());
+	mMissileHits.erase(std::unique(mMissileHits.begin(), mMissileHits.end()), mMissileHits.end());
+	std::sort(mShipHits.begin(), mShipHits.end());
+
+	// resolve. a missile takes out the first target still standing
 	int i;
-	for (i = (int)mRocks.size() - 1; i >= 0; i--)
+	for (i = 0; i < mMissileHits.size(); i++)
+	{
+		const MissileHit &hit = mMissileHits[i];
+		Missile *missile = missiles[hit.Missile];
+		GameEntity *target = (hit.Target == HitAlien) ? (GameEntity *)mAlien : (GameEntity *)mRocks[hit.Target];
+		if (missile->IsDead() || target->IsDead())
+			continue;
+
+		AddExplosion(target->GetX(), target->GetY(), target->GetZ());
+		target->Kill();
+		missile->Kill();
+		mPlayerShip.PlayRockExplosion();
+
+		if (hit.Target == HitAlien)
+		{
+			mStats.AliensDestroyed++;
+		}
+		else
+		{
+			mStats.RocksDestroyed++;
+			SplitRock(*mRocks[hit.Target]);
+		}
+	}
+
+	// the highest rock touching the ship blows up
+	int j;
+	for (j = (int)mShipHits.size() - 1; j >= 0; j--)
 	{
-		mRocks[i]->Update(deltaTime);
+		Rock *rock = mRocks[mShipHits[j]];
+		if (!rock->IsDead())
+		{
+			AddExplosion(rock->GetX(), rock->GetY(), rock->GetZ());
+			rock->Kill();
+			mPlayerShip.PlayPlayerExplosion();
+			mStats.ShipHits++;
+			LOG_INFO("Ship hit, ", mStats.ShipHits, " so far");
+			break;
+		}
 	}
 }
 
-bool Game::RemoveExplosion(Explosion *explo)
+//
+// dead rocks go back to the pool. the live ones keep their order, in one
+// pass however many died
+//
+void Game::RemoveDeadEntities()
 {
 	int i;
-	for (i = 0; i < mExplosions.size(); i++)
+	int numLive = 0;
+	for (i = 0; i < mRocks.size(); i++)
 	{
-		if (mExplosions[i] == explo)
+		if (mRocks[i]->IsDead())
 		{
-			mExplosions.erase(mExplosions.begin() + i);
-			delete explo;
-			//Debug::Log(String("removing explo"));
-			return true;
+			mRocks[i]->Release();
+			mRockPool.push_back(mRocks[i]);
 		}
+		else
+		{
+			mRocks[numLive++] = mRocks[i];
+		}
+	}
+	mRocks.resize(numLive);
+	if (numLive > mStats.PeakRocks)
+	{
+		mStats.PeakRocks = numLive;
+	}
+
+	if (mAlien && mAlien->IsDead())
+	{
+		RemoveAlien();
 	}
 
-	assert(false);
-	return false;
+	mPlayerShip.RemoveDeadMissiles();
 }
 
-void Game::UpdateExplosions(float deltaTime)
+//
+// queue this frame's positions and sprites for Unity
+//
+void Game::ApplyEntities()
 {
+	mStarfield.Draw(mSpriteBatcher);
+
 	int i;
-	for (i = (int)mExplosions.size() - 1; i >= 0; i--)
+	for (i = 0; i < mRocks.size(); i++)
+	{
+		mRocks[i]->Apply();
+	}
+	// particles are drawn by center, so grow the view by the biggest one's half size
+	const float particleExtent = 0.5f;
+	MyGame::Rectangle<float> particleView = mViewRect;
+	particleView.mTopLeft.x -= particleExtent;
+	particleView.mTopLeft.y += particleExtent;
+	particleView.mBottomRight.x += particleExtent;
+	particleView.mBottomRight.y -= particleExtent;
+	mParticles.Draw(mSpriteBatcher, particleView);
+
+	std::vector<Missile *> &missiles = mPlayerShip.GetMissiles();
+	for (i = 0; i < missiles.size(); i++)
+	{
+		missiles[i]->Apply();
+	}
+
+	if (mAlien)
+	{
+		mAlien->Apply();
+	}
+	mPlayerShip.Apply();
+
+	mCommands.DrawSprites(mSpriteBatcher.Build());
+}
+
+//
+// advance every animation, then hand the new frames to the entities that
+// changed. entities that played a clip out hear about it last
+//
+void Game::AnimateEntities(float deltaTime)
+{
+	mAnimator.Update(deltaTime);
+
+	const std::vector<SpriteAnimator::Change> &changes = mAnimator.GetChanges();
+	int i;
+	for (i = 0; i < changes.size(); i++)
+	{
+		((GameEntity *)changes[i].Owner)->SetSprite(changes[i].Sprite);
+	}
+
+	const std::vector<SpriteAnimator::Finished> &finished = mAnimator.GetFinished();
+	for (i = 0; i < finished.size(); i++)
+	{
+		((GameEntity *)finished[i].Owner)->OnAnimationFinished(finished[i].Clip);
+	}
+}
+
+//
+// one frame of gameplay. runs as a job, so it only talks to Unity through
+// the command queue
+//
+void Game::Simulate(const PlayerInput &input, float deltaTime)
+{
+	// the frame that destroyed these may still be flushing. flushes run one
+	// after another though, so its Destroys reach Unity before any spawn
+	// from this frame can reuse the slot
+	mFreeSlots.insert(mFreeSlots.end(), mReleasedSlots.begin(), mReleasedSlots.end());
+	mReleasedSlots.clear();
+
+	// spawns and anything else that's due
+	mScheduler.Advance(deltaTime);
+	AnimateEntities(deltaTime);
+
+	// input and firing
+	mPlayerShip.Update(input, deltaTime);
+
+	SimulateEntities(deltaTime);
+	CullEntities();
+	CheckCollisions();
+	RemoveDeadEntities();
+	ApplyEntities();
+	mVoices.Flush(deltaTime, mCommands);
+
+	// a headless world mixes in step with the simulation, for recording.
+	// otherwise keep the ring ahead of Unity's audio thread
+	if (mHeadless)
+	{
+		mMixer.Advance(deltaTime);
+	}
+	else if (mStreaming)
 	{
-		mExplosions[i]->Update(deltaTime);
+		mMixer.Fill(deltaTime);
 	}
+
+	mCommands.EndFrame();
 }
 
+//
+// one frame of a headless world, run right here on the calling thread
+//
+void Game::Step(const PlayerInput &input, float deltaTime)
+{
+	assert(mHeadless);
+	mDeltaTime = deltaTime;
+	Simulate(input, deltaTime);
+}
+
+//
+// main thread. drain the frame in flight from the command queue, start the
+// next one, then push the drained one to Unity while the next runs
+//
 void Game::Update(float deltaTime)
 {
-	const float timeBetweenRocks = 1.0f;
+	if (!mAssets.IsLoaded())
+	{
+		UpdateLoading();
+		Logger::GetInstance()->Flush();
+		return;
+	}
 
 	int curTime = timeGetTime();
 	mDeltaTime = ((curTime - mLastUpdateTime) / 1000.f);
 	mLastUpdateTime = curTime;
 
-	// update other game ents
-	mPlayerShip.Update(deltaTime);	// collisions checked here
-
-	if (curTime - mLastRockTime > timeBetweenRocks * 1000)
+	// stage the frame in flight as its commands stream in
+	if (mSimRunning)
 	{
-		mLastRockTime = curTime;
+		while (!mCommands.Drain(mStaged))
+		{
+			std::this_thread::yield();
+		}
+		mJobs.Wait(&mSimPending);
+	}
 
-		Rock *rock = new Rock();
-		rock->Init();
-		mRocks.push_back(rock);
-		//Debug::Log(String("adding rock"));
+	PlayerInput input = PlayerShip::ReadInput();
+	if (input.NextMode && mSimRunning)
+	{
+		mMode = (Mode)((mMode + 1) % NumModes);
+		LOG_INFO("Rock mode ", (int)mMode);
+		ResetLevel();
+	}
+	else if (input.Restart && mSimRunning)
+	{
+		ResetLevel();
 	}
 
-	UpdateRocks(deltaTime);
-	UpdateExplosions(deltaTime);
-	UpdateAlien(deltaTime);
-	CheckToAddAlien();
+	mSimRunning = true;
+	mJobs.Submit([this, input, deltaTime]() { Simulate(input, deltaTime); }, &mSimPending);
+
+	// Unity applies the finished frame while the next one simulates
+	mStaged.Flush();
+
+	FlushDeadObjects();
+
+	// wrappers the simulation let go of are released here
+	Plugin::FlushDeferredReleases();
+
+	// whatever was logged since last frame, in one go
+	Logger::GetInstance()->Flush();
 }
 
 // Called when the plugin is initialized
@@ -8,35 +8,155 @@
 #include "GameScript.h"
 #include "PlayerShip.h"
 #include "GameEntity.h"
+#include "SpawnBatch.h"
+#include "SpriteTable.h"
+#include "SpriteBatcher.h"
+#include "ParticleSystem.h"
+#include "SpriteAnimator.h"
+#include "Starfield.h"
+#include "VoiceManager.h"
+#include "Mixer.h"
+#include "GameAssets.h"
+#include "FrameCommands.h"
+#include "CommandQueue.h"
+#include "JobSystem.h"
+#include "CollisionGrid.h"
+#include "Scheduler.h"
+#include "Logger.h"
+#include <mutex>
+#include <random>
 #include <vector>
 
 //
 // main game class
 //
 class Rock;
-class Explosion;
 class Alien;
 class Game : public GameEntity
 {
+public:
+	// what happened over a run, for batch simulation
+	struct Stats
+	{
+		int RocksDestroyed;
+		int AliensDestroyed;
+		int ShipHits;
+		int RocksSplit;
+		int PeakRocks;		// most alive at once
+	};
+
+	// how rocks behave. classic rocks break up in one hit, the fragment
+	// modes split them into smaller ones. the stress mode also spawns them
+	// far faster, a heavy wave for benchmarking
+	enum Mode
+	{
+		ModeClassic,
+		ModeFragments,
+		ModeFragmentStress,
+		NumModes
+	};
+
 private:
+	JobSystem mJobs;		// never started for a headless world, its loops run inline
+	SpriteTable mSpriteTable;	// these first so they outlive the entities below
+	SpriteBatcher mSpriteBatcher;	// rocks, missiles and explosions are drawn through this
+
+	// the simulation pushes commands from its job. the main thread stages
+	// them a frame at a time and flushes that frame while the next one
+	// simulates
+	static const uint32_t CommandCapacity = 1 << 16;
+	CommandQueue mCommands;
+	FrameCommands mStaged;
+	JobSystem::Counter mSimPending;
+	bool mSimRunning;
+	bool mHeadless;			// no Unity side, commands are dropped
+
+	// object slots. simulation side only, like the entities that own them
+	std::vector<int32_t> mFreeSlots;
+	std::vector<int32_t> mReleasedSlots;	// reusable once their Destroy is flushed
+	int32_t mNextSlot;
+
+	// GameObjects made directly rather than spawned, held until one
+	// DestroyMany takes them all. main thread only
+	std::vector<GameObject> mDeadObjects;
+	std::vector<int32_t> mDeadHandles;
+
+	std::minstd_rand mRandom;
+	Scheduler mScheduler;		// timed behaviour, advanced with the simulation
+	SpriteAnimator mAnimator;	// every animated sprite, advanced in one pass
+	int mRockClip;
+	static const int MaxVoices = 8;		// one shots at once, across every clip
+	VoiceManager mVoices;		// which one shots get to play
+	Mixer mMixer;			// plays them all as one stream when the sounds could be read
+	bool mStreaming;		// Unity is pulling from mMixer's ring
+
 	PlayerShip mPlayerShip;
-	Sprite mBGSprite;		// background sprite
+	GameAssets mAssets;
+	GameEntity mBackground;
+	Starfield mStarfield;		// drawn over the background, behind everything else
 	std::vector<Rock *> mRocks;
-	std::vector<Explosion *> mExplosions;
+	std::vector<Rock *> mRockPool;	// dead rocks kept for the next spawns
+	ParticleSystem mParticles;	// explosion flashes and the debris they throw out
+	int mFlashEmitter;
+	int mDebrisEmitter;
 	Alien *mAlien;
-	int mLastRockTime;
 	int mLastUpdateTime;
-	int mLastAlienTime;
 	float mDeltaTime;
+	int mLoadPercent;		// last reported preload progress
+	MyGame::Rectangle<float> mViewRect;		// what the camera sees, for culling
+	Mode mMode;
+	Stats mStats;
+
+	// collision pass. jobs emit hit records in any order, they're sorted
+	// before being resolved so the outcome never depends on the split
+	enum { HitAlien = -1 };
+	struct MissileHit
+	{
+		int32_t Missile;
+		int32_t Target;		// rock index or HitAlien
+
+		// by missile, then highest rock first and the alien last
+		bool operator<(const MissileHit &other) const
+		{
+			return Missile != other.Missile ? Missile < other.Missile : Target > other.Target;
+		}
+		bool operator==(const MissileHit &other) const
+		{
+			return Missile == other.Missile && Target == other.Target;
+		}
+	};
+	CollisionGrid mRockGrid;
+	std::vector<CollisionGrid::Rect> mRockRects;
+	std::vector<uint8_t> mRockLive;		// not vector<bool>, jobs write neighbouring entries
+	std::vector<MissileHit> mMissileHits;
+	std::vector<int32_t> mShipHits;		// rock indices
+	std::mutex mHitsLock;
+
+	void UpdateLoading();
+	void LoadSounds();
+	int StartGameplay();
+	void AddEmitters();
+	void AddAnimations();
+	void AddVoiceClips();
 
-	void CheckToAddAlien();
+	void Simulate(const PlayerInput &input, float deltaTime);
+	Scheduler::Task SpawnRocks();
+	Rock *NewRock();
+	void SplitRock(const Rock &rock);
+	void ResetStats();
+	Scheduler::Task RollForAliens();
 	int AddAlien();
-	void UpdateRocks(float deltaTime);
-	void UpdateExplosions(float deltaTime);
-	void UpdateAlien(float deltaTime);
+	void AnimateEntities(float deltaTime);
+	void SimulateEntities(float deltaTime);
+	void CullEntities();
+	void CheckCollisions();
+	void RemoveDeadEntities();
+	void ApplyEntities();
+	void FlushDeadObjects();
+	void ResetLevel();
 
 public:
-	// singleton
+	// the world Unity shows. batch runs make their own headless ones
 	static Game *GetInstance() 
 	{
 		static Game theInstance;
@@ -45,18 +165,38 @@ public:
 
 	static String GetName() { return String("GameObject"); }
 
-	Game() {}
-	virtual ~Game() {}
+	explicit Game(bool headless = false);
+	virtual ~Game();
 
 	int Init();
+	int LoadHeadless(const char *packPath);
+	int InitHeadless(const Game &source, uint32_t seed);
+	void Step(const PlayerInput &input, float deltaTime);
 	PlayerShip &GetPlayerShip() { return mPlayerShip;  }
+	SpriteTable &GetSpriteTable() { return mSpriteTable; }
+	SpriteBatcher &GetSpriteBatcher() { return mSpriteBatcher; }
+	CommandQueue &GetCommands() { return mCommands; }
+	JobSystem &GetJobs() { return mJobs; }
+	Scheduler &GetScheduler() { return mScheduler; }
+	SpriteAnimator &GetAnimator() { return mAnimator; }
+	int GetRockClip() const { return mRockClip; }
+	VoiceManager &GetVoices() { return mVoices; }
+	Mixer &GetMixer() { return mMixer; }
+	int32_t AllocSlot();
+	void DestroySlot(int32_t slot);
+	void DestroyObject(const GameObject &go);
+	int Rand() { return (int)(mRandom() % ((unsigned)RAND_MAX + 1)); }	// like rand(), but per game
+	const GameAssets &GetAssets() const { return mAssets; }
+	int GetLoadPercent() const { return mLoadPercent; }
+	const Stats &GetStats() const { return mStats; }
+	void SetMode(Mode mode) { mMode = mode; }		// takes effect from the next StartGameplay
+	Mode GetMode() const { return mMode; }
 	void Update(float deltaTime);
-	bool RemoveRock(Rock *rock);
-	bool RemoveExplosion(Explosion *explo);
 	void RemoveAlien();
-	int AddExplosion(Vector3 &pos);
+	int AddExplosion(float x, float y, float z);
 	float GetDeltaTime() const { return mDeltaTime;  }
 	const std::vector<Rock *> &GetRocks() const { return mRocks; }
-	const std::vector<Explosion *> &GetExplosions() const { return mExplosions; }
+	const MyGame::Rectangle<float> &GetViewRect() const { return mViewRect; }
+	const ParticleSystem &GetParticles() const { return mParticles; }
 	Alien *GetAlien() { return mAlien;  }
 };
\ No newline at end of file
@@ -0,0 +1,285 @@
+//
+// implementation for asset preloading
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "GameAssets.h"
+#include "Mixer.h"
+#include "SpriteTable.h"
+#include "Logger.h"
+#include <string>
+
+GameAssets::GameAssets()
+	: mLoaded(false)
+	, FireSound(nullptr)
+	, PlayerExplosionSound(nullptr)
+	, RockExplosionSound(nullptr)
+	, AlienSound(nullptr)
+{
+	Background = ShipLeft = ShipRight = ShipCenter = -1;
+	Missile = Alien = Star = RockFrames = ExplosionFrames = -1;
+	FireLength = PlayerExplosionLength = RockExplosionLength = AlienLength = 0;
+	FireSample = PlayerExplosionSample = RockExplosionSample = AlienSample = -1;
+
+	int i;
+	for (i = 0; i < NumSheets; i++)
+	{
+		mPackTextures[i] = nullptr;
+		mPackFrames[i] = nullptr;
+	}
+	for (i = 0; i < NumClips; i++)
+	{
+		mPackSounds[i] = nullptr;
+	}
+}
+
+//
+// start loading everything, one call per sprite sequence or list. sprite
+// indices are valid right away but the sprites only arrive as Poll runs
+//
+int GameAssets::BeginLoad()
+{
+	// all at once if there's a pack, Poll just finishes up
+	if (LoadPack() == 0)
+		return 0;
+
+	// Paths of sprites within the Unity Assets/Resources folder, in the
+	// order the indices below expect
+	String spriteManifest = {
+		"background600x1024\n"
+		"spaceship_high_left\n"
+		"spaceship_high_right\n"
+		"spaceship_high_center\n"
+		"missile\n"
+		"ufo\n"
+		"star" };
+	int first = MyGame::NativeBatch::LoadSpritesAsync(spriteManifest);
+	Background = first;
+	ShipLeft = first + 1;
+	ShipRight = first + 2;
+	ShipCenter = first + 3;
+	Missile = first + 4;
+	Alien = first + 5;
+	Star = first + 6;
+
+	// animation frames come packed, one texture per sequence. the formats
+	// are only used if the atlases haven't been built
+	String rockAtlas = { "Atlases\\Rocks" };
+	String rockFormat = { "tile{0:D3}" };
+	RockFrames = MyGame::NativeBatch::LoadAtlasAsync(rockAtlas, rockFormat, 0, NumRockFrames);
+	String exploAtlas = { "Atlases\\Explosions" };
+	String exploFormat = { "explo64_b\\explo64_b{0:D2}" };
+	ExplosionFrames = MyGame::NativeBatch::LoadAtlasAsync(exploAtlas, exploFormat, 0, NumExplosionFrames);
+
+	String clipManifest = {
+		"Sounds\\fire\n"
+		"Sounds\\explosion_player\n"
+		"Sounds\\bangLarge\n"
+		"Sounds\\saucerBig" };
+	int numClips = MyGame::NativeBatch::LoadClipsAsync(clipManifest, mClipHandles);
+	if (numClips != NumClips)
+	{
+		return -1;
+	}
+
+	return 0;
+}
+
+//
+// map the pack and find every section the game needs in it. returns -1,
+// with nothing kept, if it isn't there or anything is missing
+//
+int GameAssets::OpenPack(const char *path)
+{
+	std::shared_ptr<AssetPack> pack(new AssetPack());
+	if (pack->Open(path) != 0)
+	{
+		LOG_INFO("No asset pack at ", path);
+		return -1;
+	}
+
+	// sheets in sprite table order. Must match AssetPacker.cs
+	const char *sheetNames[NumSheets] = { "Background", "Sprites", "Rocks", "Explosions" };
+	const uint32_t sheetFrames[NumSheets] = { 1, 6, NumRockFrames, NumExplosionFrames };
+	const char *soundNames[NumClips] = { "fire", "explosion_player", "bangLarge", "saucerBig" };
+
+	int i;
+	for (i = 0; i < NumSheets; i++)
+	{
+		mPackTextures[i] = pack->Find(AssetPack::TypeTexture, sheetNames[i]);
+		mPackFrames[i] = pack->Find(AssetPack::TypeFrames, sheetNames[i]);
+		if (!mPackTextures[i] || !mPackFrames[i] || mPackFrames[i]->Count != sheetFrames[i])
+		{
+			LOG_WARNING("Asset pack has no ", sheetNames[i], " sheet");
+			return -1;
+		}
+	}
+	for (i = 0; i < NumClips; i++)
+	{
+		mPackSounds[i] = pack->Find(AssetPack::TypeSound, soundNames[i]);
+		if (!mPackSounds[i])
+		{
+			LOG_WARNING("Asset pack has no ", soundNames[i], " sound");
+			return -1;
+		}
+	}
+
+	mPack = pack;
+	return 0;
+}
+
+//
+// sprite indices from the first sprite of each sheet
+//
+void GameAssets::SetSheetIndices(const int first[NumSheets])
+{
+	Background = first[0];
+	ShipLeft = first[1];
+	ShipRight = first[1] + 1;
+	ShipCenter = first[1] + 2;
+	Missile = first[1] + 3;
+	Alien = first[1] + 4;
+	Star = first[1] + 5;
+	RockFrames = first[2];
+	ExplosionFrames = first[3];
+}
+
+//
+// map the asset pack and have Unity make every sprite straight from it.
+// the clips are only stand-ins with the right length, the mixer plays the
+// packed sounds. returns -1 with nothing made if there's no usable pack
+//
+int GameAssets::LoadPack()
+{
+	char path[1024];
+	if (MyGame::NativeBatch::GetPackPath(path, sizeof(path)) <= 0)
+		return -1;
+	if (OpenPack(path) != 0)
+	{
+		LOG_INFO("Loading from Resources");
+		return -1;
+	}
+
+	int first[NumSheets];
+	int i;
+	for (i = 0; i < NumSheets; i++)
+	{
+		first[i] = MyGame::NativeBatch::AddPackSprites((void *)mPack->GetData(*mPackTextures[i]),
+			(int)mPackTextures[i]->Width, (int)mPackTextures[i]->Height,
+			(void *)mPack->GetData(*mPackFrames[i]), (int)mPackFrames[i]->Count);
+	}
+	SetSheetIndices(first);
+
+	for (i = 0; i < NumClips; i++)
+	{
+		mClipHandles[i] = MyGame::NativeBatch::CreatePackClip((int)mPackSounds[i]->Count, (int)mPackSounds[i]->Width);
+	}
+	return 0;
+}
+
+//
+// everything from the pack with no Unity at all, for a headless host.
+// sprites only go in the table, for their bounds and UVs, and there are
+// no clips, the mixer has the sounds. loaded as soon as it returns 0
+//
+int GameAssets::LoadHeadless(const char *packPath, SpriteTable &sprites)
+{
+	if (OpenPack(packPath) != 0)
+		return -1;
+
+	int first[NumSheets];
+	int i;
+	for (i = 0; i < NumSheets; i++)
+	{
+		first[i] = sprites.AddSheet((const float *)mPack->GetData(*mPackFrames[i]), (int)mPackFrames[i]->Count,
+			(int)mPackTextures[i]->Width, (int)mPackTextures[i]->Height);
+	}
+	SetSheetIndices(first);
+
+	float lengths[NumClips];
+	for (i = 0; i < NumClips; i++)
+	{
+		lengths[i] = (float)mPackSounds[i]->Count / mPackSounds[i]->Width;
+	}
+	FireLength = lengths[0];
+	PlayerExplosionLength = lengths[1];
+	RockExplosionLength = lengths[2];
+	AlienLength = lengths[3];
+
+	mLoaded = true;
+	return 0;
+}
+
+//
+// call once a frame until it returns 1. returns load progress from 0 to 1
+//
+float GameAssets::Poll()
+{
+	if (mLoaded)
+		return 1.0f;
+
+	float progress = MyGame::NativeBatch::PollLoads();
+	if (progress >= 1.0f)
+	{
+		FireSound = AudioClip(Plugin::InternalUse::Only, mClipHandles[0]);
+		PlayerExplosionSound = AudioClip(Plugin::InternalUse::Only, mClipHandles[1]);
+		RockExplosionSound = AudioClip(Plugin::InternalUse::Only, mClipHandles[2]);
+		AlienSound = AudioClip(Plugin::InternalUse::Only, mClipHandles[3]);
+
+		float lengths[NumClips];
+		MyGame::NativeBatch::GetClipLengths(mClipHandles, lengths, NumClips);
+		FireLength = lengths[0];
+		PlayerExplosionLength = lengths[1];
+		RockExplosionLength = lengths[2];
+		AlienLength = lengths[3];
+		mLoaded = true;
+	}
+	return progress;
+}
+
+//
+// give the mixer its sounds, after Poll is done. they're played in place
+// from the pack, or without one decoded from the clips' .wav files on
+// disk. returns -1 and leaves the samples at -1 if any can't be read,
+// Unity's copies of the clips still play then
+//
+int GameAssets::LoadSamples(Mixer &mixer)
+{
+	int samples[NumClips];
+	int i;
+	if (mPack)
+	{
+		for (i = 0; i < NumClips; i++)
+		{
+			const AssetPack::Section &sound = *mPackSounds[i];
+			samples[i] = mixer.AddSound((const float *)mPack->GetData(sound), (int)sound.Count, (int)sound.Width, mPack);
+		}
+	}
+	else
+	{
+		char directory[1024];
+		if (MyGame::NativeBatch::GetSoundDirectory(directory, sizeof(directory)) <= 0)
+			return -1;
+
+		// same order as the clip manifest
+		const char *names[NumClips] = { "fire.wav", "explosion_player.wav", "bangLarge.wav", "saucerBig.wav" };
+		for (i = 0; i < NumClips; i++)
+		{
+			samples[i] = mixer.Load((std::string(directory) + names[i]).c_str());
+			if (samples[i] < 0)
+			{
+				LOG_WARNING("Couldn't decode ", names[i]);
+				return -1;
+			}
+		}
+	}
+
+	FireSample = samples[0];
+	PlayerExplosionSample = samples[1];
+	RockExplosionSample = samples[2];
+	AlienSample = samples[3];
+	return 0;
+}
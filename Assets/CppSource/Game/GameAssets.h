@@ -0,0 +1,76 @@
+#pragma once
+
+//
+// every sprite and sound the game uses, preloaded asynchronously at startup
+//
+
+#include "Bindings.h"
+#include "AssetPack.h"
+#include <memory>
+
+class Mixer;
+class SpriteTable;
+
+class GameAssets
+{
+private:
+	static const int NumClips = 4;
+	static const int NumSheets = 4;
+
+	int32_t mClipHandles[NumClips];	// filled in by Unity as the clips arrive
+	bool mLoaded;
+
+	// everything comes from here instead of Resources if there is one.
+	// shared with headless worlds, the mixer plays sounds in place
+	std::shared_ptr<AssetPack> mPack;
+	const AssetPack::Section *mPackTextures[NumSheets];
+	const AssetPack::Section *mPackFrames[NumSheets];
+	const AssetPack::Section *mPackSounds[NumClips];
+
+	int OpenPack(const char *path);
+	void SetSheetIndices(const int first[NumSheets]);
+	int LoadPack();
+
+public:
+	static const int NumRockFrames = 16;
+	static const int NumExplosionFrames = 62;
+
+	// sprite table indices
+	int Background;
+	int ShipLeft;
+	int ShipRight;
+	int ShipCenter;
+	int Missile;
+	int Alien;
+	int Star;
+	int RockFrames;			// first of NumRockFrames
+	int ExplosionFrames;	// first of NumExplosionFrames
+
+	// sounds
+	AudioClip FireSound;
+	AudioClip PlayerExplosionSound;
+	AudioClip RockExplosionSound;
+	AudioClip AlienSound;
+	float FireLength;		// seconds
+	float PlayerExplosionLength;
+	float RockExplosionLength;
+	float AlienLength;
+
+	// mixer sounds, decoded from the same files. -1 unless all of them loaded
+	int FireSample;
+	int PlayerExplosionSample;
+	int RockExplosionSample;
+	int AlienSample;
+
+	GameAssets();
+
+	int GetNumSprites() const { return ExplosionFrames + NumExplosionFrames; }	// explosions load last
+
+	int BeginLoad();
+	float Poll();
+	bool IsLoaded() const { return mLoaded; }
+	int LoadSamples(Mixer &mixer);
+
+	int LoadHeadless(const char *packPath, SpriteTable &sprites);
+	int GetPackSampleRate() const { return mPack ? (int)mPackSounds[0]->Width : 0; }
+};
@@ -7,56 +7,154 @@ using namespace System;
 using namespace UnityEngine;
 
 #include "GameEntity.h"
+#include "Game.h"
+
+GameEntity::GameEntity(Game *game)
+	: mGame(game)
+	, mGo(nullptr)
+	, mSlot(-1)
+	, mLayer(-1)
+	, mX(0)
+	, mY(0)
+	, mZ(0)
+	, mSprite(0)
+	, mScale(1.0f)
+	, mMoved(false)
+	, mSpriteChanged(false)
+	, mDead(false)
+	, mVisible(true)
+	, mShown(true)
+{
+}
 
 GameEntity::~GameEntity()
 {
-	UnityEngine::Object::Destroy(mGo);
+	if (mSlot >= 0)
+	{
+		// the GameObject goes when the main thread flushes this frame
+		mGame->DestroySlot(mSlot);
+	}
+	else if (mGo != nullptr && mGame != this)
+	{
+		// main thread, like Init. batched with the rest of the frame's
+		mGame->DestroyObject(mGo);
+	}
+}
+
+//
+// queue the spawned GameObject for destruction and forget the slot
+//
+void GameEntity::Despawn()
+{
+	if (mSlot >= 0)
+	{
+		mGame->DestroySlot(mSlot);
+		mSlot = -1;
+	}
+}
+
+//
+// back to life for a pooled entity. batched entities only, a spawned one
+// would still own its slot
+//
+void GameEntity::Reuse()
+{
+	mDead = false;
+	mMoved = false;
+	mSpriteChanged = false;
+	mVisible = true;
+	mShown = true;
+	mScale = 1.0f;
 }
 
+//
+// create the GameObject right away, main thread only. Most entities queue
+// a Spawn instead so they share one call into Unity
+//
 int GameEntity::Init(System::String &name)
 {
-	mGo.SetName(name);
+	mGo = GameObject(name);
 
 	return 0;
 }
 
-// bindings code has a bug when generating this, so I made my own
-Vector3 operator*(Vector3 v, float d)
+//
+// take a slot and queue a spawn at the current position and sprite
+//
+void GameEntity::Spawn(SpawnBatch::Archetype archetype, const AudioClip *clip)
+{
+	mSlot = mGame->AllocSlot();
+	mGame->GetCommands().Spawn(mSlot, archetype, mX, mY, mZ, mSprite, clip);
+	mMoved = false;
+	mSpriteChanged = false;
+}
+
+void GameEntity::SetPosition(float x, float y, float z)
 {
-	return Vector3(v.x*d, v.y*d, v.z*d);
+	mX = x;
+	mY = y;
+	mZ = z;
+	mMoved = true;
 }
 
-// 
-// return unity sprite bounds
 //
-Bounds GameEntity::GetBounds()
+// change sprite by table index. reaches Unity on the next Apply
+//
+void GameEntity::SetSprite(int32_t sprite)
 {
-	return mGo.GetComponent<SpriteRenderer>().GetBounds();
+	if (sprite != mSprite)
+	{
+		mSprite = sprite;
+		mSpriteChanged = true;
+	}
 }
 
 //
-// static helper
+// world space bounds of the current sprite at the entity's scale, then
+// scaled again about its center. native only, so it's safe to call from jobs
 //
-void GameEntity::ScaleBounds(Bounds &bounds, float scaleFactor)
+MyGame::Rectangle<float> GameEntity::GetRect(float scaleFactor) const
 {
-	Vector3 &max = bounds.GetMax();
-	Vector3 &min = bounds.GetMin();
-	Vector3 ctr = (min + max) * 0.5f;
-	Vector3 ctrToMax = max - ctr;
-	Vector3 ctrToMin = min - ctr;
+	const SpriteTable::SpriteBounds &bounds = mGame->GetSpriteTable().GetBounds(mSprite);
+	float cx = mX + bounds.CenterX * mScale;
+	float cy = mY + bounds.CenterY * mScale;
+	float ex = bounds.ExtentX * mScale * scaleFactor;
+	float ey = bounds.ExtentY * mScale * scaleFactor;
 
-	bounds.SetMax(ctr + ctrToMax * scaleFactor);
-	bounds.SetMin(ctr + ctrToMin * scaleFactor);
+	typedef MyGame::Rectangle<float>::PointType Point;
+	return MyGame::Rectangle<float>(Point(cx - ex, cy + ey), Point(cx + ex, cy - ey));
 }
 
-Vector3 GameEntity::GetPosition()
+//
+// queue whatever changed since last frame for Unity. batched entities
+// are drawn every frame they're visible whether they changed or not.
+// spawned ones get one last sync as they leave the view, so Unity's copy
+// ends up off screen, then sleep until they're back
+//
+void GameEntity::Apply()
 {
-	return mGo.GetTransform().GetPosition();
-}
+	if (mLayer >= 0)
+	{
+		if (mVisible)
+		{
+			mGame->GetSpriteBatcher().Add(mLayer, mSprite, mX, mY, mZ, mScale);
+		}
+		return;
+	}
 
+	if (mSlot < 0 || (!mVisible && !mShown))
+		return;
+	mShown = mVisible;
 
-void GameEntity::SetPosition(Vector3 &pos)
-{
-	mGo.GetTransform().SetPosition(pos);
+	CommandQueue &commands = mGame->GetCommands();
+	if (mMoved)
+	{
+		commands.SetPosition(mSlot, mX, mY, mZ);
+		mMoved = false;
+	}
+	if (mSpriteChanged)
+	{
+		commands.SetSprite(mSlot, mSprite);
+		mSpriteChanged = false;
+	}
 }
-
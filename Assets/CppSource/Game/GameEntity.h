@@ -5,20 +5,58 @@
 //
 
 #include "Bindings.h"
+#include "Rect.h"
+#include "SpawnBatch.h"
+#include "SpriteBatcher.h"
 
+class Game;
 class GameEntity
 {
 protected:
-	GameObject mGo;
+	Game *mGame;			// the world this entity lives in
+	GameObject mGo;			// only for objects made directly by Init
+	int32_t mSlot;			// object slot in Unity's table, -1 until spawned
+	int32_t mLayer;			// sprite layer it's drawn in instead, -1 for none
+
+	// native copy of what Unity shows. Simulate only touches these, Apply
+	// queues the changes for the main thread to push to Unity
+	float mX, mY, mZ;
+	int32_t mSprite;		// sprite table index
+	float mScale;			// of the sprite and its rect. batched entities only draw it
+	bool mMoved;			// position changed since the last Apply
+	bool mSpriteChanged;	// sprite changed since the last Apply
+	bool mDead;				// removed by the game after the collision pass
+	bool mVisible;			// overlaps the camera, set by the game's cull pass
+	bool mShown;			// Unity's copy may still be on screen
 
 public:
-	GameEntity() { }
+	GameEntity(Game *game);
 	virtual ~GameEntity();
 
 	int Init(System::String &name);
-	Bounds GetBounds();
+	void Spawn(SpawnBatch::Archetype archetype, const AudioClip *clip = nullptr);
+	bool IsSpawned() const { return mSlot >= 0; }
+	void Despawn();
+	void DrawInLayer(SpriteBatcher::Layer layer) { mLayer = layer; }
+	int32_t GetSlot() const { return mSlot; }
+
+	float GetX() const { return mX; }
+	float GetY() const { return mY; }
+	float GetZ() const { return mZ; }
+	void SetPosition(float x, float y, float z);
+	void SetSprite(int32_t sprite);
+	void SetScale(float scale) { mScale = scale; }
+	MyGame::Rectangle<float> GetRect(float scaleFactor) const;
+
+	void Kill() { mDead = true; }
+	bool IsDead() const { return mDead; }
+	void Reuse();
+
+	// a clip it played once through the game's SpriteAnimator has ended
+	virtual void OnAnimationFinished(int) {}
+
+	void SetVisible(bool visible) { mVisible = visible; }
+	bool IsVisible() const { return mVisible; }
 
-	Vector3 GetPosition();
-	void SetPosition(Vector3 &pos);
-	static void ScaleBounds(Bounds &bounds, float scaleFactor);
+	void Apply();
 };
@@ -0,0 +1,171 @@
+//
+// implementation for the work stealing job system
+//
+
+#include "JobSystem.h"
+
+thread_local JobSystem *JobSystem::sOwner = nullptr;
+thread_local int JobSystem::sQueueIndex = 0;
+
+JobSystem::JobSystem()
+	: mNumQueued(0)
+	, mRunning(false)
+{
+}
+
+JobSystem::~JobSystem()
+{
+	Stop();
+}
+
+//
+// spin up the pool. the calling thread helps out whenever it waits
+//
+void JobSystem::Start(int numWorkers)
+{
+	Stop();
+
+	mRunning = true;
+	mQueues.push_back(new Queue());
+	int i;
+	for (i = 0; i < numWorkers; i++)
+	{
+		mQueues.push_back(new Queue());
+	}
+	for (i = 0; i < numWorkers; i++)
+	{
+		mThreads.push_back(std::thread(&JobSystem::WorkerMain, this, i + 1));
+	}
+}
+
+void JobSystem::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mSleepLock);
+		mRunning = false;
+	}
+	mWake.notify_all();
+
+	int i;
+	for (i = 0; i < mThreads.size(); i++)
+	{
+		mThreads[i].join();
+	}
+	mThreads.clear();
+
+	for (i = 0; i < mQueues.size(); i++)
+	{
+		delete mQueues[i];
+	}
+	mQueues.clear();
+	mNumQueued = 0;
+}
+
+//
+// queue a job on the calling thread's deque, or the shared one if it
+// isn't one of ours. pending is bumped now and dropped when the job finishes
+//
+void JobSystem::Submit(const Job &job, Counter *pending)
+{
+	pending->fetch_add(1);
+
+	if (mQueues.empty())
+	{
+		// not started, just run it
+		job();
+		pending->fetch_sub(1);
+		return;
+	}
+
+	Queue *queue = mQueues[GetQueueIndex()];
+	{
+		std::lock_guard<std::mutex> lock(queue->Lock);
+		Task task = { job, pending };
+		queue->Tasks.push_back(task);
+	}
+	{
+		std::lock_guard<std::mutex> lock(mSleepLock);
+		mNumQueued++;
+	}
+	mWake.notify_one();
+}
+
+//
+// run jobs until everything in the group is done
+//
+void JobSystem::Wait(Counter *pending)
+{
+	while (pending->load() > 0)
+	{
+		if (!RunOne(GetQueueIndex()))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::WorkerMain(int queueIndex)
+{
+	sOwner = this;
+	sQueueIndex = queueIndex;
+
+	while (mRunning)
+	{
+		if (RunOne(queueIndex))
+			continue;
+
+		std::unique_lock<std::mutex> lock(mSleepLock);
+		mWake.wait(lock, [this]() { return mNumQueued > 0 || !mRunning; });
+	}
+}
+
+bool JobSystem::RunOne(int queueIndex)
+{
+	if (mQueues.empty())
+		return false;
+
+	Task task;
+	if (!Pop(queueIndex, task) && !Steal(queueIndex, task))
+		return false;
+
+	mNumQueued--;
+	task.Fn();
+	task.Pending->fetch_sub(1);
+	return true;
+}
+
+//
+// newest job from our own deque, it's most likely still in cache
+//
+bool JobSystem::Pop(int queueIndex, Task &task)
+{
+	Queue *queue = mQueues[queueIndex];
+	std::lock_guard<std::mutex> lock(queue->Lock);
+	if (queue->Tasks.empty())
+		return false;
+
+	task = queue->Tasks.back();
+	queue->Tasks.pop_back();
+	return true;
+}
+
+//
+// oldest job from someone else's deque
+//
+bool JobSystem::Steal(int queueIndex, Task &task)
+{
+	int numQueues = (int)mQueues.size();
+	int i;
+	for (i = 1; i < numQueues; i++)
+	{
+		Queue *queue = mQueues[(queueIndex + i) % numQueues];
+		std::lock_guard<std::mutex> lock(queue->Lock);
+		if (!queue->Tasks.empty())
+		{
+			task = queue->Tasks.front();
+			queue->Tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
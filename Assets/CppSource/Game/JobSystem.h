@@ -0,0 +1,98 @@
+#pragma once
+
+//
+// work stealing job system. every thread in the pool owns a deque of jobs,
+// takes its own work from the back and steals from the front of the others
+// when it runs dry. a thread waiting on a job group runs jobs while it waits
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem
+{
+public:
+	typedef std::function<void()> Job;
+	typedef std::atomic<int> Counter;	// jobs still pending in a group
+
+private:
+	struct Task
+	{
+		Job Fn;
+		Counter *Pending;
+	};
+
+	struct Queue
+	{
+		std::mutex Lock;
+		std::deque<Task> Tasks;
+	};
+
+	std::vector<Queue *> mQueues;		// [0] is shared by threads outside the pool
+	std::vector<std::thread> mThreads;
+	std::mutex mSleepLock;
+	std::condition_variable mWake;
+	std::atomic<int> mNumQueued;
+	std::atomic<bool> mRunning;
+
+	// the pool the calling thread works for, and its deque there. every
+	// JobSystem shares these, so they only count when the owner matches
+	static thread_local JobSystem *sOwner;
+	static thread_local int sQueueIndex;
+
+	int GetQueueIndex() const { return sOwner == this ? sQueueIndex : 0; }
+	void WorkerMain(int queueIndex);
+	bool RunOne(int queueIndex);
+	bool Pop(int queueIndex, Task &task);
+	bool Steal(int queueIndex, Task &task);
+
+public:
+	JobSystem();
+	~JobSystem();
+
+	void Start(int numWorkers);
+	void Stop();
+	int GetNumThreads() const { return (int)mThreads.size() + 1; }
+
+	void Submit(const Job &job, Counter *pending);
+	void Wait(Counter *pending);
+
+	template<typename F> void ParallelFor(int count, int grain, const F &fn);
+};
+
+//
+// run fn(begin, end) over [0, count) split into chunks of at least grain
+// items. returns once every chunk is done
+//
+template<typename F>
+void JobSystem::ParallelFor(int count, int grain, const F &fn)
+{
+	if (count <= 0)
+		return;
+
+	// a few chunks per thread so stealing can even out uneven work
+	int numChunks = GetNumThreads() * 4;
+	int chunk = (count + numChunks - 1) / numChunks;
+	if (chunk < grain)
+		chunk = grain;
+
+	if (chunk >= count || mThreads.empty())
+	{
+		fn(0, count);
+		return;
+	}
+
+	Counter pending(0);
+	int begin;
+	for (begin = 0; begin < count; begin += chunk)
+	{
+		int end = begin + chunk < count ? begin + chunk : count;
+		Submit([&fn, begin, end]() { fn(begin, end); }, &pending);
+	}
+	Wait(&pending);
+}
@@ -0,0 +1,211 @@
+//
+// implementation for the native log
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "Logger.h"
+#include <string.h>
+
+void Logger::Line::Append(const char *text)
+{
+	while (*text != 0 && mLength < LineChars)
+	{
+		mText[mLength++] = *text++;
+	}
+}
+
+void Logger::Line::Append(char c)
+{
+	if (mLength < LineChars)
+		mText[mLength++] = c;
+}
+
+void Logger::Line::AppendUnsigned(uint64_t value)
+{
+	char digits[20];
+	int count = 0;
+	do
+	{
+		digits[count++] = (char)('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	while (count > 0)
+	{
+		Append(digits[--count]);
+	}
+}
+
+void Logger::Line::AppendSigned(int64_t value)
+{
+	if (value < 0)
+	{
+		Append('-');
+		AppendUnsigned(0 - (uint64_t)value);
+	}
+	else
+	{
+		AppendUnsigned((uint64_t)value);
+	}
+}
+
+//
+// values too big for fixed point come out as inf
+//
+void Logger::Line::Append(double value)
+{
+	if (value != value)
+	{
+		Append("nan");
+		return;
+	}
+	if (value < 0)
+	{
+		Append('-');
+		value = -value;
+	}
+	if (value >= 1e15)
+	{
+		Append("inf");
+		return;
+	}
+
+	uint64_t thousandths = (uint64_t)(value * 1000 + 0.5);
+	AppendUnsigned(thousandths / 1000);
+	Append('.');
+	uint64_t fraction = thousandths % 1000;
+	Append((char)('0' + fraction / 100));
+	Append((char)('0' + fraction / 10 % 10));
+	Append((char)('0' + fraction % 10));
+}
+
+Logger::Logger()
+	: mRing(Capacity)
+	, mHead(0)
+	, mTail(0)
+	, mDropped(0)
+{
+	uint32_t i;
+	for (i = 0; i < Capacity; i++)
+	{
+		mRing[i].Sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+//
+// any thread. claim a slot, fill it, then hand it to the reader. never
+// waits, a full ring drops the message
+//
+void Logger::Push(int level, const Line &line)
+{
+	uint32_t pos = mHead.load(std::memory_order_relaxed);
+	Entry *entry;
+	for (;;)
+	{
+		entry = &mRing[pos & (Capacity - 1)];
+		int32_t diff = (int32_t)(entry->Sequence.load(std::memory_order_acquire) - pos);
+		if (diff == 0)
+		{
+			if (mHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+		{
+			mDropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		else
+		{
+			pos = mHead.load(std::memory_order_relaxed);
+		}
+	}
+
+	entry->Level = (uint8_t)level;
+	entry->Length = (uint8_t)line.GetLength();
+	memcpy(entry->Text, line.GetText(), line.GetLength());
+	entry->Sequence.store(pos + 1, std::memory_order_release);
+}
+
+//
+// move every finished message into mFlushText, a line each. byLevel sorts
+// them by the Unity call they go out through, otherwise they all stay in
+// order in OutputLog
+//
+void Logger::Collect(bool byLevel)
+{
+	static const char *prefixes[] = { "[debug] ", "", "[warning] ", "[error] " };
+	static const Output outputs[] = { OutputLog, OutputLog, OutputWarning, OutputError };
+
+	int i;
+	for (i = 0; i < NumOutputs; i++)
+	{
+		mFlushText[i].clear();
+	}
+	for (;;)
+	{
+		Entry &entry = mRing[mTail & (Capacity - 1)];
+		if (entry.Sequence.load(std::memory_order_acquire) != mTail + 1)
+			break;
+
+		std::vector<char> &text = mFlushText[byLevel ? outputs[entry.Level & 3] : OutputLog];
+		const char *prefix = prefixes[entry.Level & 3];
+		text.insert(text.end(), prefix, prefix + strlen(prefix));
+		text.insert(text.end(), entry.Text, entry.Text + entry.Length);
+		text.push_back('\n');
+
+		entry.Sequence.store(mTail + Capacity, std::memory_order_release);
+		mTail++;
+	}
+
+	uint32_t dropped = mDropped.exchange(0, std::memory_order_relaxed);
+	if (dropped > 0)
+	{
+		Line line;
+		line.Append("[warning] ");
+		line.Append(dropped);
+		line.Append(" log messages dropped\n");
+		std::vector<char> &text = mFlushText[byLevel ? OutputWarning : OutputLog];
+		text.insert(text.end(), line.GetText(), line.GetText() + line.GetLength());
+	}
+}
+
+//
+// main thread. everything logged since the last flush, in at most one
+// Debug.Log, one Debug.LogWarning and one Debug.LogError, so the console
+// shows warnings and errors as such
+//
+void Logger::Flush()
+{
+	Collect(true);
+
+	int i;
+	for (i = 0; i < NumOutputs; i++)
+	{
+		std::vector<char> &text = mFlushText[i];
+		if (text.empty())
+			continue;
+
+		text.back() = 0;	// the last newline
+		String message(text.data());
+		if (i == OutputError)
+			Debug::LogError(message);
+		else if (i == OutputWarning)
+			Debug::LogWarning(message);
+		else
+			Debug::Log(message);
+	}
+}
+
+void Logger::Flush(FILE *file)
+{
+	Collect(false);
+	std::vector<char> &text = mFlushText[OutputLog];
+	if (text.empty())
+		return;
+
+	fwrite(text.data(), 1, text.size(), file);
+	fflush(file);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+//
+// native logging. messages are formatted without printf into a lock free
+// ring that any thread can write, and the main thread hands them to Unity
+// once a frame, one call for each of Log, LogWarning and LogError that has
+// anything to say. headless runs flush to a file instead.
+// levels below LOG_MIN_LEVEL compile away to nothing
+//
+//	LOG_INFO("Loading ", percent, "%");
+//
+
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_ERROR 3
+
+#ifndef LOG_MIN_LEVEL
+	#ifdef _DEBUG
+		#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+	#else
+		#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+	#endif
+#endif
+
+#define LOG_AT(level, ...) \
+	do { if constexpr ((level) >= LOG_MIN_LEVEL) Logger::GetInstance()->Write((level), __VA_ARGS__); } while (0)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_AT(LOG_LEVEL_WARNING, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+class Logger
+{
+public:
+	static const int LineChars = 120;	// longer messages are cut short
+
+	// one message being put together, on the writer's stack
+	class Line
+	{
+	private:
+		char mText[LineChars];
+		int mLength;
+
+		void AppendSigned(int64_t value);
+		void AppendUnsigned(uint64_t value);
+
+	public:
+		Line() : mLength(0) {}
+
+		const char *GetText() const { return mText; }
+		int GetLength() const { return mLength; }
+
+		void Append(const char *text);
+		void Append(char c);
+		void Append(bool value) { Append(value ? "true" : "false"); }
+		void Append(int value) { AppendSigned(value); }
+		void Append(long value) { AppendSigned(value); }
+		void Append(long long value) { AppendSigned(value); }
+		void Append(unsigned value) { AppendUnsigned(value); }
+		void Append(unsigned long value) { AppendUnsigned(value); }
+		void Append(unsigned long long value) { AppendUnsigned(value); }
+		void Append(double value);		// fixed point, 3 places
+		void Append(float value) { Append((double)value); }
+	};
+
+private:
+	static const uint32_t Capacity = 1024;	// power of two
+
+	// 128 bytes, a message a slot
+	struct Entry
+	{
+		std::atomic<uint32_t> Sequence;	// says whose turn the slot is
+		uint8_t Level;
+		uint8_t Length;
+		char Text[LineChars + 2];
+	};
+
+	std::vector<Entry> mRing;
+	alignas(64) std::atomic<uint32_t> mHead;	// next to claim, shared by writers
+	alignas(64) uint32_t mTail;					// next to read, main thread only
+	std::atomic<uint32_t> mDropped;				// messages lost to a full ring
+
+	// what a flush collects. headless, everything goes to OutputLog in order
+	enum Output
+	{
+		OutputLog,			// debug and info
+		OutputWarning,
+		OutputError,
+		NumOutputs
+	};
+	std::vector<char> mFlushText[NumOutputs];
+
+	Logger();
+
+	void Push(int level, const Line &line);
+	void Collect(bool byLevel);
+
+public:
+	static Logger *GetInstance()
+	{
+		static Logger theInstance;
+		return &theInstance;
+	}
+
+	template<typename... Args>
+	void Write(int level, const Args &... args)
+	{
+		Line line;
+		(line.Append(args), ...);
+		Push(level, line);
+	}
+
+	// one reader at a time
+	void Flush();				// to Unity, main thread
+	void Flush(FILE *file);		// headless
+};
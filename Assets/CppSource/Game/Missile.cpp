@@ -6,51 +6,31 @@ using namespace UnityEngine;
 #include "Missile.h"
 #include "Game.h"
 
-// statics
-Sprite Missile::MissileSprite = nullptr;
-
-int Missile::Init(const Vector3 &shipPos)
+int Missile::Init(float shipX, float shipY, float shipZ)
 {
-	int ret = GameEntity::Init(GetName());
-	if (ret<0)
-	{
-		return ret;
-	}
-
-	mSpeed = Game::GetInstance()->GetPlayerShip().GetSpeed() * 2.0f;
+	int ret = 0;
 
-	// add missile image
-	if (MissileSprite == nullptr)
-	{
-		String spritePath = { "missile" };
-		MissileSprite = Resources::Load<Sprite>(spritePath);
-	}
-
-	mGo.AddComponent<SpriteRenderer>();
-	mGo.GetComponent<SpriteRenderer>().SetSprite(MissileSprite);
+	mSpeed = mGame->GetPlayerShip().GetSpeed() * 2.0f;
 
 	const float shipYOffset = .27f;
 	const float shipXOffset = -.005f;
-	mGo.GetTransform().SetPosition(Vector3(shipPos.x + shipXOffset, shipPos.y + shipYOffset, shipPos.z));
+	SetPosition(shipX + shipXOffset, shipY + shipYOffset, shipZ);
+	SetSprite(mGame->GetAssets().Missile);
+	DrawInLayer(SpriteBatcher::LayerMissiles);
 
 	return ret;
 }
 
-// returns true if missile was removed
-bool Missile::Update(float deltaTime)
+//
+// runs on a job thread, so native state only
+//
+void Missile::Simulate(float deltaTime)
 {
-//	Debug::Log(String("Missile Update"));
-
-	Vector3 &pos = mGo.GetTransform().GetPosition();
-	pos.y = pos.y + mSpeed * deltaTime;
-	mGo.GetTransform().SetPosition(pos);
+	SetPosition(mX, mY + mSpeed * deltaTime, mZ);
 
 	const float maxY = 2.5f;
-	if (pos.y > maxY)
+	if (mY > maxY)
 	{	// off screen
-//		Debug::Log(String("Missile Dead"));
-		Game::GetInstance()->GetPlayerShip().RemoveMissile(this);
-		return true;
+		Kill();
 	}
-	return false;
 }
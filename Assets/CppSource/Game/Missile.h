@@ -10,16 +10,15 @@
 class Missile : public GameEntity
 {
 private:
-	static Sprite MissileSprite;		// missile sprite
 	float mSpeed;
 
 public:
 	static String GetName() { return String("Missile"); }
 
-	Missile() { }
+	Missile(Game *game) : GameEntity(game) { }
 	virtual ~Missile() { }
 
-	int Init(const Vector3 &shipPos);
-	bool Update(float deltaTime);
+	int Init(float shipX, float shipY, float shipZ);
+	void Simulate(float deltaTime);
 };
 
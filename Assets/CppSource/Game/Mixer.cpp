@@ -0,0 +1,277 @@
+//
+// implementation for the software mixer
+//
+
+#include "Mixer.h"
+#include <stdio.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MIXER_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MIXER_NEON
+#include <arm_neon.h>
+#endif
+
+//
+// out += in * gain, for count floats
+//
+static void MixAdd(float *out, const float *in, float gain, int count)
+{
+	int i = 0;
+#if defined(MIXER_SSE)
+	__m128 g = _mm_set1_ps(gain);
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(in + i), g)));
+	}
+#elif defined(MIXER_NEON)
+	for (; i + 4 <= count; i += 4)
+	{
+		vst1q_f32(out + i, vmlaq_n_f32(vld1q_f32(out + i), vld1q_f32(in + i), gain));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] += in[i] * gain;
+	}
+}
+
+//
+// keep the mix in [-1, 1] so a pile of explosions clips instead of wrapping
+//
+static void Clamp(float *out, int count)
+{
+	int i = 0;
+#if defined(MIXER_SSE)
+	__m128 lo = _mm_set1_ps(-1.0f);
+	__m128 hi = _mm_set1_ps(1.0f);
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_ps(out + i, _mm_min_ps(hi, _mm_max_ps(lo, _mm_loadu_ps(out + i))));
+	}
+#elif defined(MIXER_NEON)
+	float32x4_t lo = vdupq_n_f32(-1.0f);
+	float32x4_t hi = vdupq_n_f32(1.0f);
+	for (; i + 4 <= count; i += 4)
+	{
+		vst1q_f32(out + i, vminq_f32(hi, vmaxq_f32(lo, vld1q_f32(out + i))));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		out[i] = out[i] > 1.0f ? 1.0f : (out[i] < -1.0f ? -1.0f : out[i]);
+	}
+}
+
+Mixer::Mixer(int sampleRate)
+	: mSampleRate(sampleRate)
+	, mNextId(1)
+	, mRing(new Ring())
+	, mPendingFrames(0)
+	, mRecorder(nullptr)
+{
+	mRing->WritePos.store(0);
+	mRing->ReadPos.store(0);
+}
+
+void Mixer::SetSampleRate(int sampleRate)
+{
+	mSampleRate = sampleRate;
+}
+
+//
+// read and decode a .wav. returns the sound's index, or -1
+//
+int Mixer::Load(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	if (!file)
+		return -1;
+
+	std::vector<uint8_t> bytes;
+	uint8_t buffer[4096];
+	size_t count;
+	while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+	{
+		bytes.insert(bytes.end(), buffer, buffer + count);
+	}
+	fclose(file);
+
+	std::shared_ptr<Sound> sound(new Sound());
+	if (!DecodeWav(bytes, mSampleRate, sound->Owned))
+		return -1;
+
+	sound->Samples = sound->Owned.data();
+	sound->NumFrames = (int)sound->Owned.size() / NumChannels;
+	mSounds.push_back(sound);
+	return (int)mSounds.size() - 1;
+}
+
+//
+// a sound that's already decoded, like one in the asset pack. played in
+// place if it's at the output rate, owner is held for as long as it's
+// needed. otherwise it's resampled to a copy
+//
+int Mixer::AddSound(const float *samples, int numFrames, int rate, const std::shared_ptr<const void> &owner)
+{
+	std::shared_ptr<Sound> sound(new Sound());
+	if (rate == mSampleRate)
+	{
+		sound->Samples = samples;
+		sound->NumFrames = numFrames;
+		sound->Owner = owner;
+	}
+	else
+	{
+		ResampleStereo(samples, numFrames, rate, mSampleRate, sound->Owned);
+		sound->Samples = sound->Owned.data();
+		sound->NumFrames = (int)sound->Owned.size() / NumChannels;
+	}
+	mSounds.push_back(sound);
+	return (int)mSounds.size() - 1;
+}
+
+//
+// use another mixer's decoded sounds, with the same indices
+//
+void Mixer::ShareSounds(const Mixer &source)
+{
+	mSampleRate = source.mSampleRate;
+	mSounds = source.mSounds;
+}
+
+//
+// start a voice. returns its id, which stays unique, or 0 for none
+//
+int32_t Mixer::Play(int sound, float gain, bool loop)
+{
+	if (sound < 0 || sound >= (int)mSounds.size())
+		return 0;
+
+	Voice voice;
+	voice.Source = mSounds[sound].get();
+	voice.Pos = 0;
+	voice.Gain = gain;
+	voice.Loop = loop;
+	voice.Id = mNextId++;
+	mVoices.push_back(voice);
+	return voice.Id;
+}
+
+void Mixer::Stop(int32_t voice)
+{
+	int i;
+	for (i = 0; i < mVoices.size(); i++)
+	{
+		if (mVoices[i].Id == voice)
+		{
+			mVoices.erase(mVoices.begin() + i);
+			return;
+		}
+	}
+}
+
+void Mixer::StopAll()
+{
+	mVoices.clear();
+}
+
+//
+// add one voice's next frames to out, wrapping if it loops
+//
+void Mixer::MixVoice(Voice &voice, float *out, int frames)
+{
+	const Sound &sound = *voice.Source;
+	while (frames > 0 && voice.Pos < sound.NumFrames)
+	{
+		int n = sound.NumFrames - voice.Pos;
+		n = n < frames ? n : frames;
+		MixAdd(out, &sound.Samples[voice.Pos * NumChannels], voice.Gain, n * NumChannels);
+		out += n * NumChannels;
+		frames -= n;
+		voice.Pos += n;
+		if (voice.Pos == sound.NumFrames && voice.Loop)
+		{
+			voice.Pos = 0;
+		}
+	}
+}
+
+//
+// the next frames of every voice, summed into out. voices that have
+// played out are dropped
+//
+void Mixer::Mix(float *out, int frames)
+{
+	int i;
+	for (i = 0; i < frames * NumChannels; i++)
+	{
+		out[i] = 0;
+	}
+
+	int live = 0;
+	for (i = 0; i < mVoices.size(); i++)
+	{
+		MixVoice(mVoices[i], out, frames);
+		if (mVoices[i].Pos < mVoices[i].Source->NumFrames)
+		{
+			mVoices[live++] = mVoices[i];
+		}
+	}
+	mVoices.resize(live);
+
+	Clamp(out, frames * NumChannels);
+}
+
+//
+// top the ring up ahead of what Unity has read. called once a frame, and
+// Unity's audio thread drains it in between, so it has to hold out until
+// the next call. keep two of the last frame's worth in it, at least
+// MinFillFrames, which rides out one frame twice as long as the one before
+//
+void Mixer::Fill(float deltaTime)
+{
+	Ring &ring = *mRing;
+	uint32_t writePos = ring.WritePos.load(std::memory_order_relaxed);
+	uint32_t readPos = ring.ReadPos.load(std::memory_order_acquire);
+	int buffered = (int)(writePos - readPos);
+	if (buffered < 0 || buffered > RingFrames)
+	{	// reader lost its place, start again from it
+		writePos = readPos;
+		buffered = 0;
+	}
+
+	int ahead = (int)(2 * deltaTime * mSampleRate);
+	ahead = ahead > MinFillFrames ? ahead : MinFillFrames;
+	ahead = ahead < RingFrames ? ahead : RingFrames;
+	int frames = ahead - buffered;
+	while (frames > 0)
+	{
+		// up to the end of the ring, then around
+		int at = (int)(writePos & (RingFrames - 1));
+		int n = RingFrames - at;
+		n = n < frames ? n : frames;
+		Mix(&ring.Samples[at * NumChannels], n);
+		writePos += n;
+		frames -= n;
+	}
+	ring.WritePos.store(writePos, std::memory_order_release);
+}
+
+//
+// headless. mix deltaTime's worth, into the recorder if there is one
+//
+void Mixer::Advance(float deltaTime)
+{
+	mPendingFrames += deltaTime * mSampleRate;
+	int frames = (int)mPendingFrames;
+	mPendingFrames -= frames;
+
+	mScratch.resize(frames * NumChannels);
+	Mix(mScratch.data(), frames);
+	if (mRecorder)
+	{
+		mRecorder->Write(mScratch.data(), frames);
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+//
+// software mixer. sounds are decoded once to stereo floats at the output
+// rate, voices are mixed four samples at a time into a ring buffer, and
+// Unity's audio thread copies out of the ring from one OnAudioFilterRead.
+// nothing on the audio thread calls back into native code
+//
+
+#include "Wav.h"
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+class Mixer
+{
+public:
+	static const int NumChannels = 2;
+	static const int RingFrames = 16384;	// power of two, a third of a second at 48k
+	static const int MinFillFrames = 2048;	// least that's kept ahead of Unity, a few short frames
+
+	// shared with NativeBatch.cs, which reads from it on the audio thread.
+	// Must match the offsets there
+	struct Ring
+	{
+		alignas(64) std::atomic<uint32_t> WritePos;		// frames written, ever
+		alignas(64) std::atomic<uint32_t> ReadPos;		// frames Unity has taken
+		alignas(64) float Samples[RingFrames * NumChannels];
+	};
+
+private:
+	struct Sound
+	{
+		const float *Samples;			// interleaved stereo, in Owned or Owner
+		int NumFrames;
+		std::vector<float> Owned;		// decoded or resampled here
+		std::shared_ptr<const void> Owner;	// keeps someone else's samples alive
+	};
+
+	struct Voice
+	{
+		const Sound *Source;
+		int Pos;			// next frame
+		float Gain;
+		bool Loop;
+		int32_t Id;
+	};
+
+	int mSampleRate;
+	std::vector<std::shared_ptr<const Sound>> mSounds;	// shared by headless worlds
+	std::vector<Voice> mVoices;
+	int32_t mNextId;
+	std::unique_ptr<Ring> mRing;
+	std::vector<float> mScratch;
+	double mPendingFrames;		// headless, part frames not mixed yet
+	WavWriter *mRecorder;
+
+	void MixVoice(Voice &voice, float *out, int frames);
+
+public:
+	explicit Mixer(int sampleRate);
+
+	void SetSampleRate(int sampleRate);		// before anything is loaded
+	int GetSampleRate() const { return mSampleRate; }
+	int Load(const char *path);
+	int AddSound(const float *samples, int numFrames, int rate, const std::shared_ptr<const void> &owner);
+	void ShareSounds(const Mixer &source);
+	int GetNumSounds() const { return (int)mSounds.size(); }
+
+	int32_t Play(int sound, float gain, bool loop);
+	void Stop(int32_t voice);
+	void StopAll();
+	int GetNumVoices() const { return (int)mVoices.size(); }
+
+	void Mix(float *out, int frames);
+	void Fill(float deltaTime);
+	void Advance(float deltaTime);
+	void Record(WavWriter *recorder) { mRecorder = recorder; }
+
+	Ring *GetRing() { return mRing.get(); }
+};
@@ -0,0 +1,223 @@
+//
+// implementation for the native particle system
+//
+
+#include "ParticleSystem.h"
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PARTICLES_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PARTICLES_NEON
+#include <arm_neon.h>
+#endif
+
+//
+// in [min, max]. worked out from the raw generator output rather than a std
+// distribution, whose results differ between standard libraries. the same
+// seed gives the same particles on the same build, but the cos and sin in
+// Emit aren't the same to the last bit everywhere, so don't expect one
+// platform's particles to match another's
+//
+static float RandRange(std::minstd_rand &random, float min, float max)
+{
+	float t = (float)(random() - random.min()) / (float)(random.max() - random.min());
+	return min + (max - min) * t;
+}
+
+int ParticleSystem::AddEmitter(const Emitter &emitter)
+{
+	mEmitters.push_back(emitter);
+	return (int)mEmitters.size() - 1;
+}
+
+//
+// make room for count particles, rounded up to a whole number of lanes
+//
+void ParticleSystem::Reserve(int count)
+{
+	int size = (count + 3) & ~3;
+	if (size <= (int)mX.size())
+		return;
+
+	mX.resize(size, 0);
+	mY.resize(size, 0);
+	mZ.resize(size, 0);
+	mVX.resize(size, 0);
+	mVY.resize(size, 0);
+	mDrag.resize(size, 0);
+	mAge.resize(size, 0);
+	mLife.resize(size, 0);
+	mFrame.resize(size, 0);
+	mFrameRate.resize(size, 0);
+	mEmitter.resize(size, 0);
+}
+
+void ParticleSystem::Move(int from, int to)
+{
+	mX[to] = mX[from];
+	mY[to] = mY[from];
+	mZ[to] = mZ[from];
+	mVX[to] = mVX[from];
+	mVY[to] = mVY[from];
+	mDrag[to] = mDrag[from];
+	mAge[to] = mAge[from];
+	mLife[to] = mLife[from];
+	mFrame[to] = mFrame[from];
+	mFrameRate[to] = mFrameRate[from];
+	mEmitter[to] = mEmitter[from];
+}
+
+//
+// one burst from the emitter at the given position
+//
+void ParticleSystem::Emit(int emitter, float x, float y, float z, std::minstd_rand &random)
+{
+	const Emitter &e = mEmitters[emitter];
+	Reserve(mCount + e.Count);
+
+	int i;
+	for (i = mCount; i < mCount + e.Count; i++)
+	{
+		float angle = RandRange(random, 0, 6.2831853f);
+		float speed = RandRange(random, e.MinSpeed, e.MaxSpeed);
+
+		mX[i] = x;
+		mY[i] = y;
+		mZ[i] = z;
+		mVX[i] = std::cos(angle) * speed;
+		mVY[i] = std::sin(angle) * speed;
+		mDrag[i] = e.Drag;
+		mAge[i] = 0;
+		mLife[i] = RandRange(random, e.MinLife, e.MaxLife);
+		mFrame[i] = e.Loop ? RandRange(random, 0, (float)e.NumSprites) : 0;
+		mFrameRate[i] = RandRange(random, e.MinFrameRate, e.MaxFrameRate);
+		mEmitter[i] = emitter;
+	}
+	mCount += e.Count;
+}
+
+//
+// move, slow and age everything four at a time, then drop the particles
+// that have run out, keeping the rest in order. every path multiplies then
+// adds, no fused multiply-add, so the vector loops match the scalar one
+//
+void ParticleSystem::Update(float deltaTime)
+{
+	int count = (mCount + 3) & ~3;
+	float *x = mX.data();
+	float *y = mY.data();
+	float *vx = mVX.data();
+	float *vy = mVY.data();
+	float *drag = mDrag.data();
+	float *age = mAge.data();
+	float *frame = mFrame.data();
+	float *frameRate = mFrameRate.data();
+	int i;
+
+#if defined(PARTICLES_SSE)
+	__m128 dt = _mm_set1_ps(deltaTime);
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 zero = _mm_setzero_ps();
+	for (i = 0; i < count; i += 4)
+	{
+		__m128 velX = _mm_loadu_ps(vx + i);
+		__m128 velY = _mm_loadu_ps(vy + i);
+		_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(velX, dt)));
+		_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(velY, dt)));
+
+		__m128 keep = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(drag + i), dt)));
+		_mm_storeu_ps(vx + i, _mm_mul_ps(velX, keep));
+		_mm_storeu_ps(vy + i, _mm_mul_ps(velY, keep));
+
+		_mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), dt));
+		_mm_storeu_ps(frame + i, _mm_add_ps(_mm_loadu_ps(frame + i), _mm_mul_ps(_mm_loadu_ps(frameRate + i), dt)));
+	}
+#elif defined(PARTICLES_NEON)
+	float32x4_t dt = vdupq_n_f32(deltaTime);
+	float32x4_t one = vdupq_n_f32(1.0f);
+	float32x4_t zero = vdupq_n_f32(0.0f);
+	for (i = 0; i < count; i += 4)
+	{
+		float32x4_t velX = vld1q_f32(vx + i);
+		float32x4_t velY = vld1q_f32(vy + i);
+		vst1q_f32(x + i, vaddq_f32(vld1q_f32(x + i), vmulq_f32(velX, dt)));
+		vst1q_f32(y + i, vaddq_f32(vld1q_f32(y + i), vmulq_f32(velY, dt)));
+
+		float32x4_t keep = vmaxq_f32(zero, vsubq_f32(one, vmulq_f32(vld1q_f32(drag + i), dt)));
+		vst1q_f32(vx + i, vmulq_f32(velX, keep));
+		vst1q_f32(vy + i, vmulq_f32(velY, keep));
+
+		vst1q_f32(age + i, vaddq_f32(vld1q_f32(age + i), dt));
+		vst1q_f32(frame + i, vaddq_f32(vld1q_f32(frame + i), vmulq_f32(vld1q_f32(frameRate + i), dt)));
+	}
+#else
+	for (i = 0; i < count; i++)
+	{
+		x[i] += vx[i] * deltaTime;
+		y[i] += vy[i] * deltaTime;
+
+		float keep = 1.0f - drag[i] * deltaTime;
+		keep = keep > 0 ? keep : 0;
+		vx[i] *= keep;
+		vy[i] *= keep;
+
+		age[i] += deltaTime;
+		frame[i] += frameRate[i] * deltaTime;
+	}
+#endif
+
+	int live = 0;
+	for (i = 0; i < mCount; i++)
+	{
+		if (mAge[i] >= mLife[i])
+			continue;
+
+		if (live != i)
+		{
+			Move(i, live);
+		}
+		live++;
+	}
+	mCount = live;
+}
+
+//
+// a quad for every live particle centered in view, in the layer its
+// emitter draws in. pass a view grown by the largest particle's half size
+// so none vanish while their edge still shows
+//
+void ParticleSystem::Draw(SpriteBatcher &batcher, const MyGame::Rectangle<float> &view) const
+{
+	int i;
+	for (i = 0; i < mCount; i++)
+	{
+		if (mX[i] < view.mTopLeft.x || mX[i] > view.mBottomRight.x ||
+			mY[i] > view.mTopLeft.y || mY[i] < view.mBottomRight.y)
+		{
+			continue;
+		}
+
+		const Emitter &e = mEmitters[mEmitter[i]];
+		int frame = (int)mFrame[i];
+		if (e.Loop)
+		{
+			frame %= e.NumSprites;
+		}
+		else if (frame >= e.NumSprites)
+		{
+			frame = e.NumSprites - 1;
+		}
+		batcher.Add(e.Layer, e.FirstSprite + frame, mX[i], mY[i], mZ[i], e.Scale);
+	}
+}
+
+//
+// every particle and emitter gone
+//
+void ParticleSystem::Clear()
+{
+	mCount = 0;
+	mEmitters.clear();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+//
+// native particles for explosions and debris. every field lives in its own
+// array so Update can integrate four particles at a time, and Draw adds
+// them all to the sprite batcher without a GameObject anywhere
+//
+
+#include "Rect.h"
+#include "SpriteBatcher.h"
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+class ParticleSystem
+{
+public:
+	// what one burst looks like
+	struct Emitter
+	{
+		int Count;					// particles a burst
+		int32_t FirstSprite;		// sprite table index of frame 0
+		int NumSprites;
+		float MinFrameRate;			// frames a second
+		float MaxFrameRate;
+		bool Loop;					// cycle the frames, otherwise hold the last
+		float MinLife, MaxLife;		// seconds
+		float MinSpeed, MaxSpeed;	// units a second, in a random direction
+		float Drag;					// fraction of speed lost a second
+		float Scale;
+		int Layer;					// sprite layer they're drawn in
+	};
+
+private:
+	std::vector<Emitter> mEmitters;
+
+	// one entry per particle. sized to a multiple of 4 so the tail needs no
+	// special case, the extra entries are never drawn
+	int mCount;
+	std::vector<float> mX, mY, mZ;
+	std::vector<float> mVX, mVY;
+	std::vector<float> mDrag;
+	std::vector<float> mAge, mLife;
+	std::vector<float> mFrame, mFrameRate;
+	std::vector<int32_t> mEmitter;
+
+	void Reserve(int count);
+	void Move(int from, int to);
+
+public:
+	ParticleSystem() : mCount(0) {}
+
+	int AddEmitter(const Emitter &emitter);
+	void Emit(int emitter, float x, float y, float z, std::minstd_rand &random);
+	void Update(float deltaTime);
+	void Draw(SpriteBatcher &batcher, const MyGame::Rectangle<float> &view) const;
+	void Clear();
+
+	int GetCount() const { return mCount; }
+};
@@ -9,211 +9,192 @@ using namespace UnityEngine;
 #include "Rock.h"
 #include "Alien.h"
 #include <assert.h>
-#include <windows.h>
 
-// for timeGetTime() usage
-#pragma comment(lib, "winmm.lib")
+PlayerShip::~PlayerShip()
+{
+	int i;
+	for (i = 0; i < mMissiles.size(); i++)
+	{
+		delete mMissiles[i];
+	}
+}
 
 //
-// load sprites
+// pick up sprites and sounds
 // set up game object
 //
 int PlayerShip::Init()
 {
-	int ret = GameEntity::Init(GetName());
-	if (ret < 0)
-	{
-		return ret;
-	}
-
-	// Path of sprites within the Unity Assets/Resources folder
-	String spriteLeftPath = { "spaceship_high_left" };
-	String spriteRightPath = { "spaceship_high_right" };
-	String spriteCenterPath = { "spaceship_high_center" };
-	String fireSoundPath = { "Sounds\\fire" };
-	String playerExploSoundPath = { "Sounds\\explosion_player" };
-	String rockExploSoundPath = { "Sounds\\bangLarge" };
+	int ret = 0;
 
 	mSpeed = 1.5f;	// meters per sec
 	mTimeBetweenShots = 0.25f;	// 4 shots per sec
-	mLastShotTime = 0;
-
-	mSpriteLeft = Resources::Load<Sprite>(spriteLeftPath);
-	mSpriteRight = Resources::Load<Sprite>(spriteRightPath);
-	mSpriteCenter = Resources::Load<Sprite>(spriteCenterPath);
-	mPlayerExplosionSound = Resources::Load<AudioClip>(playerExploSoundPath);
-	mRockExplosionSound = Resources::Load<AudioClip>(rockExploSoundPath);
-	mFireSound = Resources::Load<AudioClip>(fireSoundPath);
-
-	mGo.AddComponent<SpriteRenderer>();
-	mGo.GetComponent<SpriteRenderer>().SetSprite(mSpriteCenter);
-	mGo.AddComponent<AudioSource>();
-
-	mGo.GetTransform().SetPosition(Vector3(0, -1.5, 0));	// start near the bottom
+	mReloaded = true;	// first shot goes straight away
+
+	const GameAssets &assets = mGame->GetAssets();
+	mSpriteLeft = assets.ShipLeft;
+	mSpriteRight = assets.ShipRight;
+	mSpriteCenter = assets.ShipCenter;
+	mPlayerExplosionSound = assets.PlayerExplosionSound;
+	mRockExplosionSound = assets.RockExplosionSound;
+	mFireSound = assets.FireSound;
+
+	// start near the bottom
+	SetPosition(0, -1.5, 0);
+	SetSprite(mSpriteCenter);
+	Spawn(SpawnBatch::ArchetypePlayerShip);
 	return ret;	// ok
 }
 
 void PlayerShip::FireMissile()
 {
-	int curTime = timeGetTime();
-	if (curTime - mLastShotTime > mTimeBetweenShots * 1000)
+	if (mReloaded)
 	{
-		mLastShotTime = curTime;
-		Missile *missile = new Missile();
-		missile->Init(mGo.GetTransform().GetPosition());
+		mReloaded = false;
+		mGame->GetScheduler().Start(Reload());
+
+		Missile *missile = new Missile(mGame);
+		missile->Init(mX, mY, mZ);
 		mMissiles.push_back(missile);
-		mGo.GetComponent<AudioSource>().PlayOneShot(mFireSound);
+		mGame->GetVoices().Play(mSlot, mFireSound.Handle);
 	}
 }
 
-bool PlayerShip::RemoveMissile(Missile *missile)
+Scheduler::Task PlayerShip::Reload()
+{
+	co_await mGame->GetScheduler().Wait(mTimeBetweenShots);
+	mReloaded = true;
+}
+
+//
+// delete missiles that went off screen or hit something this frame
+//
+void PlayerShip::RemoveDeadMissiles()
 {
 	int i;
-	for (i = 0; i < mMissiles.size(); i++)
+	for (i = (int)mMissiles.size() - 1; i >= 0; i--)
 	{
-		if (mMissiles[i] == missile)
+		if (mMissiles[i]->IsDead())
 		{
+			delete mMissiles[i];
 			mMissiles.erase(mMissiles.begin() + i);
-			delete missile;
-			return true;
 		}
 	}
-
-	assert(false);
-	return false;
 }
 
-void PlayerShip::UpdateMissiles(float deltaTime)
+void PlayerShip::RemoveAllMissiles()
 {
-	Game* game = Game::GetInstance();
-
-	Bounds alienBounds = Bounds(nullptr);
-	if (game->GetAlien())
-		alienBounds = game->GetAlien()->GetBounds();
-
 	int i;
-	for (i = (int)mMissiles.size() - 1; i >= 0; i--)
+	for (i = 0; i < mMissiles.size(); i++)
 	{
-		// check for missile collision with rocks
-		bool missileRemoved = false;
-		Bounds missileBounds = mMissiles[i]->GetBounds();
-		int j;
-		for (j = (int)game->GetRocks().size() - 1; j >= 0; j--)
-		{
-			Bounds rockBounds = game->GetRocks()[j]->GetBounds();
-			ScaleBounds(rockBounds, 0.9f);
-			if (rockBounds.Intersects(missileBounds))
-			{
-				game->AddExplosion(game->GetRocks()[j]->GetPosition());
-				game->RemoveRock(game->GetRocks()[j]);
-				RemoveMissile(mMissiles[i]);
-				mGo.GetComponent<AudioSource>().PlayOneShot(mRockExplosionSound);
-				missileRemoved = true;
-				break;
-			}
-		}
-
-		if (missileRemoved)
-			continue;
+		delete mMissiles[i];
+	}
+	mMissiles.clear();
+}
 
-		if (game->GetAlien() && alienBounds.Intersects(missileBounds))
-		{
-			game->AddExplosion(game->GetAlien()->GetPosition());
-			game->RemoveAlien();
-			RemoveMissile(mMissiles[i]);
-			mGo.GetComponent<AudioSource>().PlayOneShot(mRockExplosionSound);
-			continue;
-		}
+void PlayerShip::PlayRockExplosion()
+{
+	mGame->GetVoices().Play(mSlot, mRockExplosionSound.Handle);
+}
 
-		mMissiles[i]->Update(deltaTime);
-	}
+void PlayerShip::PlayPlayerExplosion()
+{
+	mGame->GetVoices().Play(mSlot, mPlayerExplosionSound.Handle);
 }
 
 //
-// check for ship hitting rock
+// main thread. snapshot the keys for the next simulated frame
 //
-void PlayerShip::CheckRockCollision()
+PlayerInput PlayerShip::ReadInput()
 {
-	Game* game = Game::GetInstance();
-	Bounds shipBounds = GetBounds();
-	ScaleBounds(shipBounds, 0.5f);
-	int j;
-	for (j = (int)game->GetRocks().size() - 1; j >= 0; j--)
-	{
-		Bounds rockBounds = game->GetRocks()[j]->GetBounds();
-		ScaleBounds(rockBounds, 0.9f);
-		if (rockBounds.Intersects(shipBounds))
-		{
-			game->AddExplosion(game->GetRocks()[j]->GetPosition());
-			game->RemoveRock(game->GetRocks()[j]);
-			mGo.GetComponent<AudioSource>().PlayOneShot(mPlayerExplosionSound);
-			break;
-		}
-	}
+	// the bindings take non-const references, which temporaries can't
+	// bind to under /permissive-
+	String space("space");
+	String left("left");
+	String right("right");
+	String up("up");
+	String down("down");
+	String restart("r");
+	String nextMode("m");
+
+	PlayerInput input;
+	input.Fire = Input::GetKey(space);
+	input.Left = Input::GetKey(left);
+	input.Right = Input::GetKey(right);
+	input.Up = Input::GetKey(up);
+	input.Down = Input::GetKey(down);
+	input.LeftPressed = Input::GetKeyDown(left);
+	input.RightPressed = Input::GetKeyDown(right);
+	input.TurnReleased = (Input::GetKeyUp(left) || Input::GetKeyUp(right)) &&
+		!(input.Left || input.Right);
+	input.Restart = Input::GetKeyDown(restart);
+	input.NextMode = Input::GetKeyDown(nextMode);
+	return input;
 }
 
-void PlayerShip::Update(float deltaTime)
+//
+// movement and firing from a snapshot of the input. runs with the rest of
+// the simulation, off the main thread
+//
+void PlayerShip::Update(const PlayerInput &input, float deltaTime)
 {
 	const float maxX = 1.0f;
 	const float minX = -1.0f;
 	const float maxY = 0.f;
 	const float minY = -1.5f;
 
-	UpdateMissiles(deltaTime);
-	CheckRockCollision();
-
-	Vector3 pos = mGo.GetTransform().GetPosition();
+	float x = mX;
+	float y = mY;
 	bool dirty = false;
 
-	if (Input::GetKey(String("space")))
+	if (input.Fire)
 	{
 		FireMissile();
 	}
 
-	if ((Input::GetKeyUp(String("left")) || Input::GetKeyUp(String("right"))) &&
-		!(Input::GetKey(String("left")) || Input::GetKey(String("right"))))
+	if (input.TurnReleased)
 	{
-		mGo.GetComponent<SpriteRenderer>().SetSprite(mSpriteCenter);
+		SetSprite(mSpriteCenter);
 	}
 
-	if (Input::GetKeyDown(String("left")))
+	if (input.LeftPressed)
 	{
-		mGo.GetComponent<SpriteRenderer>().SetSprite(mSpriteLeft);
+		SetSprite(mSpriteLeft);
 	}
 
-	if (Input::GetKeyDown(String("right")))
+	if (input.RightPressed)
 	{
-		mGo.GetComponent<SpriteRenderer>().SetSprite(mSpriteRight);
+		SetSprite(mSpriteRight);
 	}
 
-	if (Input::GetKey(String("left")) && pos.x >= minX)
+	if (input.Left && x >= minX)
 	{
 		// left
-		pos.x = pos.x - mSpeed * deltaTime;
+		x = x - mSpeed * deltaTime;
 		dirty = true;
 	}
-	if (Input::GetKey(String("right")) && pos.x <= maxX)
+	if (input.Right && x <= maxX)
 	{
 		// right
-		pos.x = pos.x + mSpeed * deltaTime;
+		x = x + mSpeed * deltaTime;
 		dirty = true;
 	}
 
-	if (Input::GetKey(String("up")) && pos.y <= maxY)
+	if (input.Up && y <= maxY)
 	{
 		// up
-		pos.y = pos.y + mSpeed * deltaTime;
+		y = y + mSpeed * deltaTime;
 		dirty = true;
 	}
-	if (Input::GetKey(String("down")) && pos.y >= minY)
+	if (input.Down && y >= minY)
 	{
 		// down
-		pos.y = pos.y - mSpeed * deltaTime;
+		y = y - mSpeed * deltaTime;
 		dirty = true;
 	}
 
 	if (dirty)
 	{
-		mGo.GetTransform().SetPosition(pos);
+		SetPosition(x, y, mZ);
 	}
 }
@@ -6,20 +6,36 @@
 
 #include "Bindings.h"
 #include "GameEntity.h"
+#include "Scheduler.h"
 #include <vector>
 
 class Missile;
+
+//
+// the keys the ship cares about, read on the main thread and handed to
+// the simulation so it never has to call into Unity
+//
+struct PlayerInput
+{
+	bool Fire;
+	bool Left, Right, Up, Down;		// held
+	bool LeftPressed, RightPressed;	// went down this frame
+	bool TurnReleased;				// left or right came up and neither is held
+	bool Restart;					// start the level over
+	bool NextMode;					// switch rock mode, which also restarts
+};
+
 class PlayerShip : public GameEntity
 {
 private:
 	float mSpeed;
 	float mTimeBetweenShots;
-	int mLastShotTime;	// in ms
+	bool mReloaded;			// can fire again
 	
-	// player ship sprite
-	Sprite mSpriteLeft;		// for turning left
-	Sprite mSpriteRight;	// for turning right
-	Sprite mSpriteCenter;	// for going straight
+	// player ship sprite table indices
+	int mSpriteLeft;		// for turning left
+	int mSpriteRight;		// for turning right
+	int mSpriteCenter;		// for going straight
 
 	std::vector<Missile*> mMissiles;
 	AudioClip mFireSound;
@@ -27,18 +43,29 @@ private:
 	AudioClip mRockExplosionSound;
 
 	void FireMissile();
-	void UpdateMissiles(float deltaTime);
-	void CheckRockCollision();
+	Scheduler::Task Reload();
 
 public:
 	static String GetName() { return String("PlayerShip"); }
 
-	PlayerShip() {}
-	virtual ~PlayerShip() {}
+	// null clips until Init, the default constructor would make new ones in C#
+	PlayerShip(Game *game)
+		: GameEntity(game)
+		, mFireSound(nullptr)
+		, mPlayerExplosionSound(nullptr)
+		, mRockExplosionSound(nullptr)
+	{
+	}
+	virtual ~PlayerShip();
 
 	int Init();
-	void Update(float deltaTime);
+	static PlayerInput ReadInput();
+	void Update(const PlayerInput &input, float deltaTime);
 	void SetSpeed(float s) { mSpeed = s; }
 	float GetSpeed() { return mSpeed; }
-	bool RemoveMissile(Missile *missile);
+	std::vector<Missile *> &GetMissiles() { return mMissiles; }
+	void RemoveDeadMissiles();
+	void RemoveAllMissiles();
+	void PlayRockExplosion();
+	void PlayPlayerExplosion();
 };
\ No newline at end of file
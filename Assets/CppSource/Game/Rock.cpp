@@ -5,70 +5,90 @@ using namespace UnityEngine;
 
 #include "Rock.h"
 #include "Game.h"
-#include <Windows.h>	// for timeGetTime()
+#include <math.h>
 
-// statics
-Sprite *Rock::RockSprites = nullptr;
+Rock::~Rock()
+{
+	mGame->GetAnimator().Stop(mAnim);
+}
 
-int Rock::Init()
+// smaller pieces fly off faster
+static const float SizeScales[Rock::NumSizes] = { 1.0f, 0.6f, 0.35f };
+static const float SizeSpeeds[Rock::NumSizes] = { 1.0f, 1.6f, 2.2f };	// times the ship's speed
+
+//
+// everything a new rock and a fragment have in common. leaves it tumbling
+// from a random frame, so they don't all tumble in step
+//
+void Rock::Start(int size)
 {
-	int ret = GameEntity::Init(GetName());
-	if (ret<0)
-	{
-		return ret;
-	}
+	Reuse();
+	mSize = size;
+	SetScale(SizeScales[size]);
 
-	// load Rock sprites
-	if (RockSprites == nullptr)
-	{
-		RockSprites = new Sprite[NumSprites];
-		int i;
-		for (i = 0; i < NumSprites; i++)
-		{
-			char path[32];
-			sprintf_s(path, "tile%03d", i);
-			String spritePath(path);
-			RockSprites[i] = Resources::Load<Sprite>(spritePath);
-		}
-	}
+	SpriteAnimator &animator = mGame->GetAnimator();
+	mAnim = animator.Play(mGame->GetRockClip(), mGame->Rand() % NumSprites, this);
+	SetSprite(animator.GetSprite(mAnim));
+	DrawInLayer(SpriteBatcher::LayerRocks);
+}
 
-	mSpeed = Game::GetInstance()->GetPlayerShip().GetSpeed();
-	mLastSpriteTime = timeGetTime();
+//
+// a large rock falling from somewhere along the top
+//
+int Rock::Init()
+{
+	int ret = 0;
 
-	mGo.AddComponent<SpriteRenderer>();
-	mCurSprite = rand() % NumSprites;
-	mGo.GetComponent<SpriteRenderer>().SetSprite(RockSprites[mCurSprite]);
+	Start(SizeLarge);
+	mVX = 0;
+	mVY = -mGame->GetPlayerShip().GetSpeed();
 
-	float xRand = ((float)rand() / RAND_MAX) * 2.5f - 1.25f;		// rand number from -1.25 to 1.25
+	float xRand = ((float)mGame->Rand() / RAND_MAX) * 2.5f - 1.25f;		// rand number from -1.25 to 1.25
 	const float yStart = 1.5f;
-	mGo.GetTransform().SetPosition(Vector3(xRand, yStart, 0));	
+	SetPosition(xRand, yStart, 0);
 
 	return ret;
 }
 
-void Rock::Update(float deltaTime)
+//
+// a piece of parent thrown out at angle, in radians, keeping the
+// parent's own motion
+//
+int Rock::InitFragment(const Rock &parent, int size, float angle)
 {
-	//	Debug::Log(String("Rock Update"));
+	int ret = 0;
 
-	// update sprite image
-	int curTime = timeGetTime();
-	if (curTime - mLastSpriteTime > SpriteAnimTime * 1000)
-	{
-		mLastSpriteTime = curTime;
-		mCurSprite++;
-		if (mCurSprite == NumSprites)
-			mCurSprite = 0;
-		mGo.GetComponent<SpriteRenderer>().SetSprite(RockSprites[mCurSprite]);
-	}
+	Start(size);
+	float speed = mGame->GetPlayerShip().GetSpeed() * SizeSpeeds[size];
+	mVX = parent.mVX + cosf(angle) * speed;
+	mVY = parent.mVY + sinf(angle) * speed;
+	SetPosition(parent.mX, parent.mY, parent.mZ);
+
+	return ret;
+}
 
-	Vector3 &pos = GetPosition();
-	pos.y = pos.y - mSpeed * deltaTime;
-	SetPosition(pos);
+//
+// dead, and about to sit in the pool until the next Init
+//
+void Rock::Release()
+{
+	mGame->GetAnimator().Stop(mAnim);
+	mAnim = 0;
+}
 
+//
+// runs on a job thread, so native state only
+//
+void Rock::Simulate(float deltaTime)
+{
+	SetPosition(mX + mVX * deltaTime, mY + mVY * deltaTime, mZ);
+
+	// off screen. fragments can leave by any side
 	const float minY = -2.2f;
-	if (pos.y < minY)
-	{	// off screen
-		//		Debug::Log(String("Rock Dead"));
-		Game::GetInstance()->RemoveRock(this);
+	const float maxY = 2.5f;
+	const float maxX = 2.5f;
+	if (mY < minY || mY > maxY || mX < -maxX || mX > maxX)
+	{
+		Kill();
 	}
 }
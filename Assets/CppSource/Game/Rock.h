@@ -6,26 +6,43 @@
 
 #include "Bindings.h"
 #include "GameEntity.h"
+#include "GameAssets.h"
+#include "SpriteAnimator.h"
 
 class Rock : public GameEntity
 {
+public:
+	// a spawned rock is SizeLarge. in the fragment modes each hit breaks
+	// a rock into smaller ones, down to SizeSmall, which just breaks up
+	enum Size
+	{
+		SizeLarge,
+		SizeMedium,
+		SizeSmall,
+		NumSizes
+	};
+
 private:
-	const int NumSprites = 16;
-	const float SpriteAnimTime = 0.1f;
+	static const int NumSprites = GameAssets::NumRockFrames;
 
-	static Sprite *RockSprites;
+	float mVX, mVY;			// per second
+	int mSize;
+	SpriteAnimator::Id mAnim;	// tumbling, on the game's animator
 
-	float mSpeed;
-	int mCurSprite;
-	int mLastSpriteTime;
+	void Start(int size);
 
 public:
 	static String GetName() { return String("Rock"); }
 
-	Rock() { }
-	virtual ~Rock() {}
+	Rock(Game *game) : GameEntity(game), mAnim(0) { }
+	virtual ~Rock();
 
 	int Init();
-	void Update(float deltaTime);
-};
+	int InitFragment(const Rock &parent, int size, float angle);
+	void Release();
+	void Simulate(float deltaTime);
 
+	float GetVX() const { return mVX; }
+	float GetVY() const { return mVY; }
+	int GetSize() const { return mSize; }
+};
@@ -0,0 +1,88 @@
+//
+// implementation for the coroutine scheduler
+//
+
+#include "Scheduler.h"
+#include <cmath>
+
+Scheduler::Scheduler()
+	: mTime(0)
+{
+}
+
+Scheduler::~Scheduler()
+{
+	Clear();
+}
+
+//
+// drop every timer. tasks still waiting are freed without running any
+// further
+//
+void Scheduler::Clear()
+{
+	mTimers.ForEach([](void *task)
+	{
+		std::coroutine_handle<>::from_address(task).destroy();
+	});
+
+	int i;
+	for (i = 0; i < mNextFrame.size(); i++)
+	{
+		mNextFrame[i].destroy();
+	}
+	mNextFrame.clear();
+	mTimers.Clear();
+}
+
+//
+// run the task up to its first co_await
+//
+void Scheduler::Start(Task task)
+{
+	Resume(task.Handle);
+}
+
+void Scheduler::Resume(std::coroutine_handle<> handle)
+{
+	handle.resume();
+	if (handle.done())
+	{
+		handle.destroy();
+	}
+}
+
+//
+// timer callback for a task woken from a Wait
+//
+void Scheduler::ResumeTask(void *task)
+{
+	Resume(std::coroutine_handle<>::from_address(task));
+}
+
+//
+// wakes on the first frame at least secs from now
+//
+Scheduler::WaitAwaiter Scheduler::Wait(float secs)
+{
+	WaitAwaiter awaiter = { this, (uint64_t)std::ceil((mTime + secs) / TickSecs) };
+	return awaiter;
+}
+
+//
+// move time on by a frame. tasks waiting for the next frame go first, then
+// timers tick by tick
+//
+void Scheduler::Advance(float deltaTime)
+{
+	int i;
+	mResuming.swap(mNextFrame);
+	for (i = 0; i < mResuming.size(); i++)
+	{
+		Resume(mResuming[i]);
+	}
+	mResuming.clear();
+
+	mTime += deltaTime;
+	mTimers.Advance((uint64_t)(mTime / TickSecs), ResumeTask);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+//
+// coroutine tasks for timed gameplay behaviour. a waiting task sits in a
+// timer wheel until it's due, so a dormant behaviour costs nothing until
+// it wakes. tasks only run inside Advance, on whatever thread simulates
+//
+//	Scheduler::Task Game::SpawnRocks()
+//	{
+//		for (;;)
+//		{
+//			co_await mScheduler.Wait(1.0s);
+//			...
+//		}
+//	}
+//
+
+#include "TimerWheel.h"
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <stdint.h>
+#include <vector>
+
+class Scheduler
+{
+public:
+	// a coroutine for the scheduler to own. doesn't run until it's started
+	struct Task
+	{
+		struct promise_type
+		{
+			Task get_return_object() { return Task{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }	// freed by the scheduler
+			void return_void() {}
+			void unhandled_exception() { std::terminate(); }
+		};
+
+		std::coroutine_handle<> Handle;
+	};
+
+	struct WaitAwaiter
+	{
+		Scheduler *Owner;
+		uint64_t Due;		// tick to wake on
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle) { Owner->mTimers.Add(Due, handle.address()); }
+		void await_resume() const noexcept {}
+	};
+
+	struct NextFrameAwaiter
+	{
+		Scheduler *Owner;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle) { Owner->mNextFrame.push_back(handle); }
+		void await_resume() const noexcept {}
+	};
+
+	static constexpr float TickSecs = 1.0f / 128;
+
+private:
+	TimerWheel mTimers;
+	std::vector<std::coroutine_handle<>> mNextFrame;
+	std::vector<std::coroutine_handle<>> mResuming;	// scratch for Advance
+	double mTime;			// secs since the scheduler started
+
+	static void Resume(std::coroutine_handle<> handle);
+	static void ResumeTask(void *task);
+
+public:
+	Scheduler();
+	~Scheduler();
+
+	void Start(Task task);
+	void Clear();
+	void Advance(float deltaTime);
+	double GetTime() const { return mTime; }
+
+	WaitAwaiter Wait(float secs);
+	template<typename Rep, typename Period>
+	WaitAwaiter Wait(std::chrono::duration<Rep, Period> time)
+	{
+		return Wait(std::chrono::duration<float>(time).count());
+	}
+	NextFrameAwaiter NextFrame() { return NextFrameAwaiter{ this }; }
+};
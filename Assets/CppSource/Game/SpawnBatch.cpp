@@ -0,0 +1,55 @@
+//
+// implementation for batched GameObject spawning
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "SpawnBatch.h"
+#include "Alien.h"
+#include "PlayerShip.h"
+
+//
+// tell Unity how to build each archetype. Call once before the first Flush
+//
+void SpawnBatch::RegisterArchetypes()
+{
+	String alienName = Alien::GetName();
+	String shipName = PlayerShip::GetName();
+	String bgName = { "Background" };
+
+	MyGame::NativeBatch::RegisterArchetype(ArchetypeAlien, alienName, FlagAudio | FlagLoopAudio);
+	MyGame::NativeBatch::RegisterArchetype(ArchetypePlayerShip, shipName, FlagAudio);
+	MyGame::NativeBatch::RegisterArchetype(ArchetypeBackground, bgName, 0);
+}
+
+//
+// queue a spawn. Unity fills the slot on the next Flush
+//
+void SpawnBatch::Add(int32_t slot, Archetype archetype, float x, float y, float z,
+	int32_t sprite, int32_t clip)
+{
+	Desc desc;
+	desc.Slot = slot;
+	desc.Archetype = archetype;
+	desc.X = x;
+	desc.Y = y;
+	desc.Z = z;
+	desc.Sprite = sprite;
+	desc.Clip = clip;
+
+	mDescs.push_back(desc);
+}
+
+//
+// create every queued GameObject in one call
+//
+void SpawnBatch::Flush()
+{
+	if (mDescs.empty())
+		return;
+
+	MyGame::NativeBatch::Spawn(mDescs.data(), (int)mDescs.size());
+	mDescs.clear();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+//
+// queues GameObject spawns and creates them all with one call into Unity
+//
+
+#include "Bindings.h"
+#include <vector>
+
+class SpawnBatch
+{
+public:
+	// kinds of object Unity knows how to build
+	enum Archetype
+	{
+		ArchetypeAlien,
+		ArchetypePlayerShip,
+		ArchetypeBackground,
+		NumArchetypes
+	};
+
+	// per archetype options. Must match the flags in NativeBatch.cs
+	enum Flags
+	{
+		FlagAudio = 1,		// add an AudioSource
+		FlagLoopAudio = 2	// loop the spawn clip instead of playing it once
+	};
+
+	// one spawn request as Unity reads it. Must match NativeBatch.cs
+	struct Desc
+	{
+		int32_t Slot;		// object slot, assigned natively
+		int32_t Archetype;
+		float X, Y, Z;
+		int32_t Sprite;		// sprite table index
+		int32_t Clip;		// object store handle, 0 for none
+	};
+
+private:
+	std::vector<Desc> mDescs;
+
+public:
+	SpawnBatch() {}
+
+	static void RegisterArchetypes();
+
+	void Add(int32_t slot, Archetype archetype, float x, float y, float z,
+		int32_t sprite, int32_t clip);
+	void Flush();
+	bool IsEmpty() const { return mDescs.empty(); }
+};
@@ -0,0 +1,183 @@
+//
+// implementation for the sprite animation system
+//
+
+#include "SpriteAnimator.h"
+
+SpriteAnimator::SpriteAnimator()
+	: mFree(-1)
+{
+}
+
+//
+// returns the clip's index, for Play
+//
+int SpriteAnimator::AddClip(const Clip &clip)
+{
+	mClips.push_back(clip);
+	return (int)mClips.size() - 1;
+}
+
+//
+// start clip at frame for owner. the owner sets its own first sprite,
+// from GetSprite, changes come from Update after that
+//
+SpriteAnimator::Id SpriteAnimator::Play(int clip, int frame, void *owner)
+{
+	int32_t handle;
+	if (mFree >= 0)
+	{
+		handle = mFree;
+		mFree = mHandles[handle].Row;
+	}
+	else
+	{
+		handle = (int32_t)mHandles.size();
+		Handle fresh = { 0, 0 };
+		mHandles.push_back(fresh);
+	}
+
+	int32_t row = (int32_t)mOwner.size();
+	mHandles[handle].Row = row;
+	mTime.push_back(0);
+	mFrameTime.push_back(1.0f / mClips[clip].FrameRate);
+	mFrame.push_back(frame % mClips[clip].NumFrames);
+	mClip.push_back(clip);
+	mOwner.push_back(owner);
+	mHandle.push_back(handle);
+	return MakeId(handle, mHandles[handle].Generation);
+}
+
+int32_t SpriteAnimator::FindRow(Id id) const
+{
+	int32_t handle = (int32_t)(uint32_t)id - 1;
+	if (handle < 0 || handle >= (int32_t)mHandles.size() || mHandles[handle].Generation != (uint32_t)(id >> 32))
+		return -1;
+	return mHandles[handle].Row;
+}
+
+//
+// the last row moves into the gap
+//
+void SpriteAnimator::RemoveRow(int32_t row)
+{
+	int32_t handle = mHandle[row];
+	mHandles[handle].Generation++;
+	mHandles[handle].Row = mFree;
+	mFree = handle;
+
+	int32_t last = (int32_t)mOwner.size() - 1;
+	if (row != last)
+	{
+		mTime[row] = mTime[last];
+		mFrameTime[row] = mFrameTime[last];
+		mFrame[row] = mFrame[last];
+		mClip[row] = mClip[last];
+		mOwner[row] = mOwner[last];
+		mHandle[row] = mHandle[last];
+		mHandles[mHandle[row]].Row = row;
+	}
+	mTime.pop_back();
+	mFrameTime.pop_back();
+	mFrame.pop_back();
+	mClip.pop_back();
+	mOwner.pop_back();
+	mHandle.pop_back();
+}
+
+void SpriteAnimator::Stop(Id id)
+{
+	int32_t row = FindRow(id);
+	if (row >= 0)
+	{
+		RemoveRow(row);
+	}
+}
+
+//
+// the sprite an animation is showing, or -1 if it isn't playing
+//
+int32_t SpriteAnimator::GetSprite(Id id) const
+{
+	int32_t row = FindRow(id);
+	if (row < 0)
+		return -1;
+	return mClips[mClip[row]].FirstSprite + mFrame[row];
+}
+
+//
+// stop everything and forget the clips. ids from before stop nothing
+//
+void SpriteAnimator::Clear()
+{
+	while (!mOwner.empty())
+	{
+		RemoveRow((int32_t)mOwner.size() - 1);
+	}
+	mClips.clear();
+	mChanges.clear();
+	mFinished.clear();
+	mFinishedRows.clear();
+}
+
+//
+// one pass over every animation. the clock runs for all of them first,
+// in a loop the compiler can vectorize, then only the rows that crossed a
+// frame are touched. clips that play once and reach the end are stopped
+// after the pass and reported
+//
+void SpriteAnimator::Update(float deltaTime)
+{
+	mChanges.clear();
+	mFinished.clear();
+	mFinishedRows.clear();
+
+	int count = (int)mOwner.size();
+	float *time = mTime.data();
+	int i;
+	for (i = 0; i < count; i++)
+	{
+		time[i] += deltaTime;
+	}
+
+	const float *frameTime = mFrameTime.data();
+	for (i = 0; i < count; i++)
+	{
+		if (time[i] < frameTime[i])
+			continue;
+
+		// a long frame can cross more than one
+		int steps = (int)(time[i] / frameTime[i]);
+		time[i] -= steps * frameTime[i];
+
+		const Clip &clip = mClips[mClip[i]];
+		int frame = mFrame[i] + steps;
+		if (frame >= clip.NumFrames)
+		{
+			if (clip.Loop)
+			{
+				frame %= clip.NumFrames;
+			}
+			else
+			{
+				frame = clip.NumFrames - 1;
+				Finished finished = { mOwner[i], mClip[i] };
+				mFinished.push_back(finished);
+				mFinishedRows.push_back(i);
+			}
+		}
+		if (frame != mFrame[i])
+		{
+			mFrame[i] = frame;
+			Change change = { mOwner[i], clip.FirstSprite + frame };
+			mChanges.push_back(change);
+		}
+	}
+
+	// highest row first, so the row moved into each gap is never one
+	// still waiting to go
+	for (i = (int)mFinishedRows.size() - 1; i >= 0; i--)
+	{
+		RemoveRow(mFinishedRows[i]);
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+//
+// sprite animation for every animated entity, advanced in one pass. clips
+// say which frames, how fast and whether they loop or play once. each
+// playing animation is a row in packed arrays, and Update only reports
+// the ones whose frame changed, plus the ones that played out
+//
+
+#include <stdint.h>
+#include <vector>
+
+class SpriteAnimator
+{
+public:
+	struct Clip
+	{
+		int32_t FirstSprite;	// sprite table index of frame 0
+		int NumFrames;
+		float FrameRate;		// frames a second
+		bool Loop;				// otherwise it holds the last frame and finishes
+	};
+
+	typedef uint64_t Id;	// 0 is never an animation, so it can mean none
+
+	// a new sprite for an owner, from this Update
+	struct Change
+	{
+		void *Owner;
+		int32_t Sprite;
+	};
+
+	// a clip that played once to the end this Update. it's been stopped
+	struct Finished
+	{
+		void *Owner;
+		int Clip;
+	};
+
+private:
+	struct Handle
+	{
+		int32_t Row;		// in the packed arrays, or the next free handle
+		uint32_t Generation;	// bumped on stop, so stale ids stop nothing
+	};
+
+	std::vector<Clip> mClips;
+	std::vector<Handle> mHandles;
+	int32_t mFree;
+
+	// playing animations, packed. rows move when one before the end stops
+	std::vector<float> mTime;		// into the current frame
+	std::vector<float> mFrameTime;	// the clip's, kept here for the pass
+	std::vector<int32_t> mFrame;
+	std::vector<int32_t> mClip;
+	std::vector<void *> mOwner;
+	std::vector<int32_t> mHandle;	// back to mHandles
+
+	std::vector<Change> mChanges;
+	std::vector<Finished> mFinished;
+	std::vector<int32_t> mFinishedRows;		// ascending
+
+	static Id MakeId(int32_t handle, uint32_t generation) { return ((uint64_t)generation << 32) | (uint32_t)(handle + 1); }
+	int32_t FindRow(Id id) const;
+	void RemoveRow(int32_t row);
+
+public:
+	SpriteAnimator();
+
+	int AddClip(const Clip &clip);
+	Id Play(int clip, int frame, void *owner);
+	void Stop(Id id);
+	int32_t GetSprite(Id id) const;
+	void Clear();
+
+	void Update(float deltaTime);
+	const std::vector<Change> &GetChanges() const { return mChanges; }
+	const std::vector<Finished> &GetFinished() const { return mFinished; }
+
+	int GetNumPlaying() const { return (int)mOwner.size(); }
+};
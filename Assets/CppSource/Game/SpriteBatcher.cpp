@@ -0,0 +1,152 @@
+//
+// implementation for the sprite layer batcher
+//
+
+#include "SpriteBatcher.h"
+#include <cmath>
+
+SpriteBatcher::SpriteBatcher(const SpriteTable &sprites)
+	: mSprites(sprites)
+	, mLastFrame(1)
+{
+	int layer, i;
+	for (i = 0; i < 2; i++)
+	{
+		for (layer = 0; layer < NumLayers; layer++)
+		{
+			LayerDesc &desc = mFrames[i].mDescs[layer];
+			desc.Layer = layer;
+			desc.NumQuads = 0;
+			desc.NumRanges = 0;
+			desc.Pad = 0;
+			desc.Vertices = 0;
+			desc.Ranges = 0;
+		}
+	}
+}
+
+//
+// the quads added since the last Build, grouped by texture with a counting
+// sort so each texture's quads keep the order they were added in
+//
+void SpriteBatcher::BuildLayer(int layer, Frame &frame)
+{
+	std::vector<Quad> &quads = mQuads[layer];
+	std::vector<Vertex> &vertices = frame.mVertices[layer];
+	std::vector<Range> &ranges = frame.mRanges[layer];
+	int numQuads = (int)quads.size();
+	int numTextures = mSprites.GetNumTextures();
+
+	mStarts.assign(numTextures + 1, 0);
+	int i;
+	for (i = 0; i < numQuads; i++)
+	{
+		mStarts[mSprites.GetUV(quads[i].Sprite).Texture + 1]++;
+	}
+
+	ranges.clear();
+	int t;
+	for (t = 0; t < numTextures; t++)
+	{
+		if (mStarts[t + 1] > 0)
+		{
+			Range range = { t, mStarts[t], mStarts[t + 1] };
+			ranges.push_back(range);
+		}
+		mStarts[t + 1] += mStarts[t];
+	}
+
+	vertices.resize(numQuads * 4);
+	for (i = 0; i < numQuads; i++)
+	{
+		const Quad &quad = quads[i];
+		const SpriteTable::SpriteBounds &bounds = mSprites.GetBounds(quad.Sprite);
+		const SpriteTable::SpriteUV &uv = mSprites.GetUV(quad.Sprite);
+
+		float x0 = quad.X + (bounds.CenterX - bounds.ExtentX) * quad.Scale;
+		float x1 = quad.X + (bounds.CenterX + bounds.ExtentX) * quad.Scale;
+		float y0 = quad.Y + (bounds.CenterY - bounds.ExtentY) * quad.Scale;
+		float y1 = quad.Y + (bounds.CenterY + bounds.ExtentY) * quad.Scale;
+
+		Vertex *v = &vertices[mStarts[uv.Texture]++ * 4];
+		v[0] = { x0, y0, quad.Z, uv.U0, uv.V0 };
+		v[1] = { x0, y1, quad.Z, uv.U0, uv.V1 };
+		v[2] = { x1, y1, quad.Z, uv.U1, uv.V1 };
+		v[3] = { x1, y0, quad.Z, uv.U1, uv.V0 };
+	}
+	quads.clear();
+
+	LayerDesc &desc = frame.mDescs[layer];
+	desc.NumQuads = numQuads;
+	desc.NumRanges = (int32_t)ranges.size();
+	desc.Vertices = (int64_t)(intptr_t)vertices.data();
+	desc.Ranges = (int64_t)(intptr_t)ranges.data();
+}
+
+//
+// turn this frame's quads into vertex buffers. the frame returned stays as
+// it is until the Build after next
+//
+const SpriteBatcher::Frame &SpriteBatcher::Build()
+{
+	mLastFrame ^= 1;
+	Frame &frame = mFrames[mLastFrame];
+
+	int layer;
+	for (layer = 0; layer < NumLayers; layer++)
+	{
+		BuildLayer(layer, frame);
+	}
+	return frame;
+}
+
+//
+// check a built frame the way a renderer would rely on it. returns how many
+// problems turned up, for headless runs with no renderer to notice
+//
+int SpriteBatcher::Validate(const Frame &frame) const
+{
+	int errors = 0;
+	int layer, i, j;
+	for (layer = 0; layer < NumLayers; layer++)
+	{
+		const LayerDesc &desc = frame.mDescs[layer];
+		const std::vector<Vertex> &vertices = frame.mVertices[layer];
+		const std::vector<Range> &ranges = frame.mRanges[layer];
+
+		if (desc.NumQuads * 4 != (int)vertices.size() || desc.NumRanges != (int)ranges.size())
+		{
+			errors++;
+			continue;
+		}
+
+		// ranges cover every quad once, in order
+		int next = 0;
+		for (i = 0; i < ranges.size(); i++)
+		{
+			if (ranges[i].FirstQuad != next || ranges[i].NumQuads <= 0 ||
+				ranges[i].Texture < 0 || ranges[i].Texture >= mSprites.GetNumTextures())
+			{
+				errors++;
+			}
+			next = ranges[i].FirstQuad + ranges[i].NumQuads;
+		}
+		if (next != desc.NumQuads)
+			errors++;
+
+		for (i = 0; i < desc.NumQuads; i++)
+		{
+			const Vertex *v = &vertices[i * 4];
+			bool ok = v[0].X == v[1].X && v[2].X == v[3].X && v[0].Y == v[3].Y && v[1].Y == v[2].Y &&
+				v[0].X < v[2].X && v[0].Y < v[1].Y;
+			for (j = 0; j < 4; j++)
+			{
+				ok = ok && std::isfinite(v[j].X) && std::isfinite(v[j].Y) && std::isfinite(v[j].Z) &&
+					v[j].U >= 0 && v[j].U <= 1 && v[j].V >= 0 && v[j].V <= 1;
+			}
+			if (!ok)
+				errors++;
+		}
+	}
+	return errors;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+//
+// draws whole layers of sprites without a GameObject each. entities add a
+// quad a frame, Build turns a layer into one vertex buffer with its quads
+// grouped by texture, and Unity uploads it to one Mesh per layer
+//
+
+#include "SpriteTable.h"
+#include <stdint.h>
+#include <vector>
+
+class SpriteBatcher
+{
+public:
+	// back to front. Unity sorts each layer's mesh by its index
+	enum Layer
+	{
+		LayerStars,
+		LayerRocks,
+		LayerMissiles,
+		LayerExplosions,
+		NumLayers
+	};
+
+	// Must match NativeBatch.cs
+	struct Vertex
+	{
+		float X, Y, Z;
+		float U, V;
+	};
+
+	// quads sharing a texture, one submesh. Must match NativeBatch.cs
+	struct Range
+	{
+		int32_t Texture;
+		int32_t FirstQuad;
+		int32_t NumQuads;
+	};
+
+	// one layer as Unity reads it. Must match NativeBatch.cs
+	struct LayerDesc
+	{
+		int32_t Layer;
+		int32_t NumQuads;
+		int32_t NumRanges;
+		int32_t Pad;
+		int64_t Vertices;	// 4 a quad, bottom left and clockwise
+		int64_t Ranges;
+	};
+
+	// every layer for one simulated frame
+	class Frame
+	{
+	private:
+		friend class SpriteBatcher;
+
+		std::vector<Vertex> mVertices[NumLayers];
+		std::vector<Range> mRanges[NumLayers];
+		LayerDesc mDescs[NumLayers];
+
+	public:
+		const LayerDesc *GetLayers() const { return mDescs; }
+	};
+
+private:
+	struct Quad
+	{
+		int32_t Sprite;
+		float X, Y, Z;
+		float Scale;
+	};
+
+	const SpriteTable &mSprites;
+	std::vector<Quad> mQuads[NumLayers];
+	std::vector<int32_t> mStarts;		// scratch for Build
+
+	// the simulation builds one while the main thread sends the other
+	Frame mFrames[2];
+	int mLastFrame;
+
+	void BuildLayer(int layer, Frame &frame);
+
+public:
+	explicit SpriteBatcher(const SpriteTable &sprites);
+
+	void Add(int layer, int32_t sprite, float x, float y, float z, float scale = 1.0f)
+	{
+		Quad quad = { sprite, x, y, z, scale };
+		mQuads[layer].push_back(quad);
+	}
+
+	const Frame &Build();
+	const Frame &GetLastFrame() const { return mFrames[mLastFrame]; }
+	int Validate(const Frame &frame) const;
+};
@@ -0,0 +1,78 @@
+//
+// implementation for the sprite table
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "SpriteTable.h"
+#include "AssetPack.h"
+
+//
+// hand sprites to Unity's table. returns the index of the first one
+//
+int SpriteTable::Register(Sprite *sprites, int count)
+{
+	mHandles.resize(count);
+	int i;
+	for (i = 0; i < count; i++)
+	{
+		mHandles[i] = sprites[i].Handle;
+	}
+	return MyGame::NativeBatch::RegisterSprites(mHandles.data(), count);
+}
+
+//
+// fetch the bounds of the first count sprites so collision can stay native
+//
+void SpriteTable::LoadBounds(int count)
+{
+	mBounds.resize(count);
+	MyGame::NativeBatch::GetSpriteBounds(mBounds.data(), 0, count);
+}
+
+//
+// and their UVs, so whole layers can be drawn without a GameObject each
+//
+void SpriteTable::LoadUVs(int count)
+{
+	mUVs.resize(count);
+	mNumTextures = MyGame::NativeBatch::GetSpriteUVs(mUVs.data(), 0, count);
+}
+
+//
+// headless, no Unity to ask. bounds and UVs for a sheet of packed frames,
+// worked out the way NativeBatch.AddPackSprites' full rect sprites have
+// them. the sheet is the next texture. returns the index of the first
+//
+int SpriteTable::AddSheet(const float *frames, int count, int textureWidth, int textureHeight)
+{
+	int first = (int)mBounds.size();
+	mBounds.resize(first + count);
+	mUVs.resize(first + count);
+
+	int i;
+	for (i = 0; i < count; i++)
+	{
+		// x, y, width, height in pixels, pivot x, pivot y as a fraction, pixels per unit
+		const float *frame = frames + i * AssetPack::FrameWords;
+		float width = frame[2] / frame[6];
+		float height = frame[3] / frame[6];
+
+		SpriteBounds &bounds = mBounds[first + i];
+		bounds.CenterX = (0.5f - frame[4]) * width;
+		bounds.CenterY = (0.5f - frame[5]) * height;
+		bounds.ExtentX = width * 0.5f;
+		bounds.ExtentY = height * 0.5f;
+
+		SpriteUV &uv = mUVs[first + i];
+		uv.U0 = frame[0] / textureWidth;
+		uv.V0 = frame[1] / textureHeight;
+		uv.U1 = (frame[0] + frame[2]) / textureWidth;
+		uv.V1 = (frame[1] + frame[3]) / textureHeight;
+		uv.Texture = mNumTextures;
+	}
+	mNumTextures++;
+	return first;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+//
+// sprites registered with Unity once and referred to by index, plus
+// their bounds for native collision and their UVs for native batching
+//
+
+#include "Bindings.h"
+#include <vector>
+
+class SpriteTable
+{
+public:
+	// one sprite change as Unity reads it. Must match NativeBatch.cs
+	struct Command
+	{
+		int32_t Slot;		// object slot given to the spawn
+		int32_t Sprite;		// sprite index
+	};
+
+	// sprite bounds relative to its pivot. Must match NativeBatch.cs
+	struct SpriteBounds
+	{
+		float CenterX, CenterY;
+		float ExtentX, ExtentY;		// half size
+	};
+
+	// where a sprite sits on its texture. Must match NativeBatch.cs
+	struct SpriteUV
+	{
+		float U0, V0;		// bottom left
+		float U1, V1;		// top right
+		int32_t Texture;	// index into Unity's texture list
+	};
+
+private:
+	std::vector<int32_t> mHandles;
+	std::vector<SpriteBounds> mBounds;	// read only once loaded, safe from any thread
+	std::vector<SpriteUV> mUVs;			// likewise
+	int mNumTextures;
+
+public:
+	SpriteTable() : mNumTextures(0) {}
+
+	int Register(UnityEngine::Sprite *sprites, int count);
+
+	void LoadBounds(int count);
+	const SpriteBounds &GetBounds(int32_t sprite) const { return mBounds[sprite]; }
+
+	void LoadUVs(int count);
+	const SpriteUV &GetUV(int32_t sprite) const { return mUVs[sprite]; }
+	int GetNumTextures() const { return mNumTextures; }
+
+	int AddSheet(const float *frames, int count, int textureWidth, int textureHeight);
+	int GetNumSprites() const { return (int)mBounds.size(); }
+};
@@ -0,0 +1,113 @@
+//
+// implementation for the background starfield
+//
+
+#include "Starfield.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define STARFIELD_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define STARFIELD_NEON
+#include <arm_neon.h>
+#endif
+
+// far to near
+const Starfield::Depth Starfield::Depths[NumDepths] =
+{
+	{ 1600, 0.05f, 0.5f },
+	{ 800, 0.15f, 0.8f },
+	{ 200, 0.4f, 1.2f },
+};
+
+//
+// scatter the stars over the view. they have their own generator, so the
+// game's random sequence is the same with or without them
+//
+void Starfield::Init(const MyGame::Rectangle<float> &view, int32_t sprite, float z)
+{
+	mSprite = sprite;
+	mZ = z;
+	mMinY = view.mBottomRight.y;
+	mHeight = view.mTopLeft.y - view.mBottomRight.y;
+
+	mCount = 0;
+	int d;
+	for (d = 0; d < NumDepths; d++)
+	{
+		mCount += Depths[d].Count;
+	}
+	int size = (mCount + 3) & ~3;
+	mX.assign(size, 0);
+	mY.assign(size, mMinY + mHeight);	// the padding never needs to wrap
+	mSpeed.assign(size, 0);
+	mScale.assign(size, 0);
+
+	std::minstd_rand random(1);
+	float width = view.mBottomRight.x - view.mTopLeft.x;
+	float range = (float)(random.max() - random.min());
+	int i = 0;
+	for (d = 0; d < NumDepths; d++)
+	{
+		int n;
+		for (n = 0; n < Depths[d].Count; n++, i++)
+		{
+			mX[i] = view.mTopLeft.x + width * ((random() - random.min()) / range);
+			mY[i] = mMinY + mHeight * ((random() - random.min()) / range);
+			mSpeed[i] = Depths[d].Speed;
+			mScale[i] = Depths[d].Scale;
+		}
+	}
+}
+
+//
+// scroll everything down, anything off the bottom comes back in at the top
+//
+void Starfield::Update(float deltaTime)
+{
+	int count = (mCount + 3) & ~3;
+	float *y = mY.data();
+	const float *speed = mSpeed.data();
+	int i;
+
+#if defined(STARFIELD_SSE)
+	__m128 dt = _mm_set1_ps(deltaTime);
+	__m128 minY = _mm_set1_ps(mMinY);
+	__m128 height = _mm_set1_ps(mHeight);
+	for (i = 0; i < count; i += 4)
+	{
+		__m128 pos = _mm_sub_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(speed + i), dt));
+		__m128 wrap = _mm_and_ps(_mm_cmplt_ps(pos, minY), height);
+		_mm_storeu_ps(y + i, _mm_add_ps(pos, wrap));
+	}
+#elif defined(STARFIELD_NEON)
+	float32x4_t dt = vdupq_n_f32(deltaTime);
+	float32x4_t minY = vdupq_n_f32(mMinY);
+	float32x4_t height = vdupq_n_f32(mHeight);
+	float32x4_t zero = vdupq_n_f32(0.0f);
+	for (i = 0; i < count; i += 4)
+	{
+		float32x4_t pos = vmlsq_f32(vld1q_f32(y + i), vld1q_f32(speed + i), dt);
+		float32x4_t wrap = vbslq_f32(vcltq_f32(pos, minY), height, zero);
+		vst1q_f32(y + i, vaddq_f32(pos, wrap));
+	}
+#else
+	for (i = 0; i < count; i++)
+	{
+		y[i] -= speed[i] * deltaTime;
+		if (y[i] < mMinY)
+		{
+			y[i] += mHeight;
+		}
+	}
+#endif
+}
+
+void Starfield::Draw(SpriteBatcher &batcher) const
+{
+	int i;
+	for (i = 0; i < mCount; i++)
+	{
+		batcher.Add(SpriteBatcher::LayerStars, mSprite, mX[i], mY[i], mZ, mScale[i]);
+	}
+}
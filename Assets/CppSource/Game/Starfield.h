@@ -0,0 +1,48 @@
+#pragma once
+
+//
+// scrolling starfield behind the play area. a few depth layers of stars,
+// nearer ones bigger and faster, kept one array per field so Update moves
+// and wraps four at a time. drawn through the sprite batcher in one layer
+//
+
+#include "Rect.h"
+#include "SpriteBatcher.h"
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+class Starfield
+{
+public:
+	// one depth of stars
+	struct Depth
+	{
+		int Count;
+		float Speed;		// units a second, downwards
+		float Scale;		// of the star sprite
+	};
+
+private:
+	static const int NumDepths = 3;
+	static const Depth Depths[NumDepths];
+
+	// one entry per star, padded to a multiple of 4
+	int mCount;
+	std::vector<float> mX, mY;
+	std::vector<float> mSpeed;
+	std::vector<float> mScale;
+
+	int32_t mSprite;		// sprite table index of a star
+	float mMinY, mHeight;	// stars wrap from the bottom of the view to the top
+	float mZ;
+
+public:
+	Starfield() : mCount(0), mSprite(0), mMinY(0), mHeight(0), mZ(0) {}
+
+	void Init(const MyGame::Rectangle<float> &view, int32_t sprite, float z);
+	void Update(float deltaTime);
+	void Draw(SpriteBatcher &batcher) const;
+
+	int GetCount() const { return mCount; }
+};
@@ -0,0 +1,166 @@
+//
+// implementation for the hierarchical timer wheel
+//
+
+#include "TimerWheel.h"
+
+TimerWheel::TimerWheel()
+	: mFree(-1)
+	, mTick(0)
+{
+	int i;
+	for (i = 0; i < NumLevels * NumSlots; i++)
+	{
+		mHeads[i] = -1;
+		mTails[i] = -1;
+	}
+}
+
+//
+// put a node in the slot its due tick falls in, seen from the current tick.
+// the further out, the coarser the level. past the top level it parks in
+// the furthest slot and gets placed again when that cascades
+//
+void TimerWheel::Link(int32_t index)
+{
+	Node &node = mNodes[index];
+	uint64_t due = node.Due;
+	uint64_t delta = due > mTick ? due - mTick : 0;
+
+	int level = 0;
+	while (level < NumLevels - 1 && delta >= ((uint64_t)1 << (SlotBits * (level + 1))))
+	{
+		level++;
+	}
+	if (delta >= ((uint64_t)1 << (SlotBits * NumLevels)))
+	{
+		due = mTick + ((uint64_t)1 << (SlotBits * NumLevels)) - 1;
+	}
+
+	int slot = level * NumSlots + (int)((due >> (SlotBits * level)) & SlotMask);
+	node.Next = -1;
+	if (mTails[slot] >= 0)
+		mNodes[mTails[slot]].Next = index;
+	else
+		mHeads[slot] = index;
+	mTails[slot] = index;
+}
+
+void TimerWheel::Release(int32_t index)
+{
+	Node &node = mNodes[index];
+	node.Target = nullptr;
+	node.Next = mFree;
+	mFree = index;
+}
+
+//
+// fire target once due comes round. a tick already run means the next one
+//
+void TimerWheel::Add(uint64_t due, void *target)
+{
+	int32_t index;
+	if (mFree >= 0)
+	{
+		index = mFree;
+		mFree = mNodes[index].Next;
+	}
+	else
+	{
+		index = (int32_t)mNodes.size();
+		Node node = {};
+		mNodes.push_back(node);
+	}
+
+	Node &node = mNodes[index];
+	node.Due = due > mTick ? due : mTick + 1;
+	node.Target = target;
+	Link(index);
+}
+
+//
+// drop every timer without firing it
+//
+void TimerWheel::Clear()
+{
+	int i;
+	for (i = 0; i < mNodes.size(); i++)
+	{
+		if (mNodes[i].Target)
+			Release(i);
+	}
+	for (i = 0; i < NumLevels * NumSlots; i++)
+	{
+		mHeads[i] = -1;
+		mTails[i] = -1;
+	}
+}
+
+//
+// the slot at level for the current tick has reached its start. spread its
+// timers over the finer levels
+//
+void TimerWheel::Cascade(int level)
+{
+	int slot = level * NumSlots + (int)((mTick >> (SlotBits * level)) & SlotMask);
+	int32_t index = mHeads[slot];
+	mHeads[slot] = -1;
+	mTails[slot] = -1;
+
+	while (index >= 0)
+	{
+		int32_t next = mNodes[index].Next;
+		Link(index);
+		index = next;
+	}
+}
+
+//
+// run the timers in the current tick's slot, in the order they were added.
+// they're taken off the wheel first, so fire is free to add timers
+//
+void TimerWheel::Fire(FireFn fire)
+{
+	int slot = (int)(mTick & SlotMask);
+	int32_t index = mHeads[slot];
+	mHeads[slot] = -1;
+	mTails[slot] = -1;
+
+	mFired.clear();
+	while (index >= 0)
+	{
+		int32_t next = mNodes[index].Next;
+		mFired.push_back(mNodes[index].Target);
+		Release(index);
+		index = next;
+	}
+
+	int i;
+	for (i = 0; i < mFired.size(); i++)
+	{
+		fire(mFired[i]);
+	}
+}
+
+//
+// run every tick up to and including tick, calling fire with each timer's
+// target as it comes due
+//
+void TimerWheel::Advance(uint64_t tick, FireFn fire)
+{
+	while (mTick < tick)
+	{
+		mTick++;
+
+		int level;
+		for (level = 1; level < NumLevels; level++)
+		{
+			if ((mTick & (((uint64_t)1 << (SlotBits * level)) - 1)) != 0)
+				break;
+			Cascade(level);
+		}
+
+		if (mHeads[mTick & SlotMask] >= 0)
+			Fire(fire);
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+//
+// hierarchical timer wheel keyed by game ticks. adding a timer is O(1),
+// and advancing only touches the timers that come due plus the occasional
+// cascade of a coarser slot down a level. each timer is just a target,
+// handed to the callback Advance was given on the tick it comes due
+//
+
+#include <stdint.h>
+#include <vector>
+
+class TimerWheel
+{
+public:
+	typedef void (*FireFn)(void *target);
+
+private:
+	static const int SlotBits = 6;
+	static const int NumSlots = 1 << SlotBits;
+	static const int SlotMask = NumSlots - 1;
+	static const int NumLevels = 4;		// 2^24 ticks before a timer has to go round again
+
+	struct Node
+	{
+		uint64_t Due;
+		void *Target;		// null while the node is free
+		int32_t Next;		// within the slot, or the free list
+	};
+
+	std::vector<Node> mNodes;
+	int32_t mFree;
+	int32_t mHeads[NumLevels * NumSlots];
+	int32_t mTails[NumLevels * NumSlots];
+	uint64_t mTick;		// last tick run
+
+	std::vector<void *> mFired;	// scratch for firing a tick
+
+	void Link(int32_t index);
+	void Release(int32_t index);
+	void Cascade(int level);
+	void Fire(FireFn fire);
+
+public:
+	TimerWheel();
+
+	void Add(uint64_t due, void *target);
+	void Clear();
+	void Advance(uint64_t tick, FireFn fire);
+
+	template<typename F> void ForEach(const F &fn) const;
+};
+
+//
+// call fn(target) for every pending timer
+//
+template<typename F>
+void TimerWheel::ForEach(const F &fn) const
+{
+	int i;
+	for (i = 0; i < mNodes.size(); i++)
+	{
+		if (mNodes[i].Target)
+			fn(mNodes[i].Target);
+	}
+}
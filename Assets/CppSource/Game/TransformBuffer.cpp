@@ -0,0 +1,31 @@
+//
+// implementation for the batched transform updates
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "TransformBuffer.h"
+
+void TransformBuffer::SetPosition(int32_t slot, float x, float y, float z)
+{
+	Command cmd;
+	cmd.Slot = slot;
+	cmd.X = x;
+	cmd.Y = y;
+	cmd.Z = z;
+	mCommands.push_back(cmd);
+}
+
+//
+// send every queued position in one call
+//
+void TransformBuffer::Flush()
+{
+	if (mCommands.empty())
+		return;
+
+	MyGame::NativeBatch::SetPositions(mCommands.data(), (int)mCommands.size());
+	mCommands.clear();
+}
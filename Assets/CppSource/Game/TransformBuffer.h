@@ -0,0 +1,28 @@
+#pragma once
+
+//
+// position changes queued during the frame and sent to Unity in one call
+//
+
+#include "Bindings.h"
+#include <vector>
+
+class TransformBuffer
+{
+public:
+	// one position change as Unity reads it. Must match NativeBatch.cs
+	struct Command
+	{
+		int32_t Slot;		// object slot given to the spawn
+		float X, Y, Z;
+	};
+
+private:
+	std::vector<Command> mCommands;
+
+public:
+	TransformBuffer() {}
+
+	void SetPosition(int32_t slot, float x, float y, float z);
+	void Flush();
+};
@@ -0,0 +1,165 @@
+//
+// implementation for the one-shot voice manager
+//
+
+#include "VoiceManager.h"
+#include "CommandQueue.h"
+#include "Mixer.h"
+#include <algorithm>
+
+VoiceManager::VoiceManager(int maxVoices)
+	: mMaxVoices(maxVoices)
+	, mTime(0)
+	, mNumDropped(0)
+	, mNumStolen(0)
+	, mMixer(nullptr)
+{
+}
+
+void VoiceManager::AddClip(const ClipDesc &desc)
+{
+	mClips.push_back(desc);
+}
+
+const VoiceManager::ClipDesc *VoiceManager::FindClip(int32_t clip) const
+{
+	int i;
+	for (i = 0; i < mClips.size(); i++)
+	{
+		if (mClips[i].Clip == clip)
+			return &mClips[i];
+	}
+	return nullptr;
+}
+
+//
+// make room for a voice of the given priority by ending the lowest
+// priority voice below it, the one nearest its end if there are several.
+// a mixer voice stops at once, a one shot on an AudioSource can't be
+// stopped so it plays out over the cap
+//
+bool VoiceManager::Steal(int priority)
+{
+	int victim = -1;
+	int i;
+	for (i = 0; i < mVoices.size(); i++)
+	{
+		const Voice &voice = mVoices[i];
+		if (voice.Priority >= priority)
+			continue;
+		if (victim < 0 || voice.Priority < mVoices[victim].Priority ||
+			(voice.Priority == mVoices[victim].Priority && voice.EndTime < mVoices[victim].EndTime))
+		{
+			victim = i;
+		}
+	}
+	if (victim < 0)
+		return false;
+
+	if (mMixer && mVoices[victim].MixerVoice != 0)
+	{
+		mMixer->Stop(mVoices[victim].MixerVoice);
+	}
+	mVoices.erase(mVoices.begin() + victim);
+	mNumStolen++;
+	return true;
+}
+
+//
+// ask for a clip this frame. simulation side, like the rest of gameplay
+//
+void VoiceManager::Play(int32_t slot, int32_t clip)
+{
+	const ClipDesc *desc = FindClip(clip);
+	Request request;
+	request.Slot = slot;
+	request.Clip = clip;
+	request.Priority = desc ? desc->Priority : 0;
+	request.Order = (int)mRequests.size();
+	mRequests.push_back(request);
+}
+
+//
+// end of the frame. forget voices that have finished, then hand out what
+// voices are free to this frame's requests by priority, stealing from
+// lower priorities once they run out. a clip asked for twice in one frame
+// only plays once
+//
+void VoiceManager::Flush(float deltaTime, CommandQueue &commands)
+{
+	mTime += deltaTime;
+
+	int i, j;
+	int numVoices = 0;
+	for (i = 0; i < mVoices.size(); i++)
+	{
+		if (mVoices[i].EndTime > mTime)
+		{
+			mVoices[numVoices++] = mVoices[i];
+		}
+	}
+	mVoices.resize(numVoices);
+
+	if (mRequests.empty())
+		return;
+
+	std::sort(mRequests.begin(), mRequests.end(), [](const Request &a, const Request &b)
+	{
+		return a.Priority != b.Priority ? a.Priority > b.Priority : a.Order < b.Order;
+	});
+
+	for (i = 0; i < mRequests.size(); i++)
+	{
+		const Request &request = mRequests[i];
+
+		bool repeat = false;
+		for (j = 0; j < i && !repeat; j++)
+		{
+			repeat = mRequests[j].Clip == request.Clip;
+		}
+		if (repeat)
+			continue;
+
+		const ClipDesc *desc = FindClip(request.Clip);
+		int playing = 0;
+		for (j = 0; j < mVoices.size(); j++)
+		{
+			if (mVoices[j].Clip == request.Clip)
+				playing++;
+		}
+		if ((desc && playing >= desc->MaxVoices) ||
+			((int)mVoices.size() >= mMaxVoices && !Steal(request.Priority)))
+		{
+			mNumDropped++;
+			continue;
+		}
+
+		Voice voice;
+		voice.Clip = request.Clip;
+		voice.Priority = request.Priority;
+		voice.EndTime = mTime + (desc ? desc->Length : 0);
+		voice.MixerVoice = 0;
+		if (mMixer && desc && desc->Sound >= 0)
+		{
+			voice.MixerVoice = mMixer->Play(desc->Sound, 1.0f, false);
+		}
+		else
+		{
+			commands.PlayOneShot(request.Slot, request.Clip);
+		}
+		mVoices.push_back(voice);
+	}
+	mRequests.clear();
+}
+
+//
+// forget every clip and voice, for a new level. the mixer stays
+//
+void VoiceManager::Clear()
+{
+	mClips.clear();
+	mVoices.clear();
+	mRequests.clear();
+	mNumDropped = 0;
+	mNumStolen = 0;
+}
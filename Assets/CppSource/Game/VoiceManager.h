@@ -0,0 +1,72 @@
+#pragma once
+
+//
+// decides which one-shot sounds actually play. gameplay asks for sounds as
+// things happen, then once a frame Flush drops repeats of the same clip,
+// keeps each clip and the whole game under their voice caps, highest
+// priority first, and plays what's left on the mixer, or queues it for
+// the one PlayOneShots call if the clip has no mixer sound. when every
+// voice is taken a request steals one from a lower priority clip, so the
+// caps don't have to add up to the game's
+//
+
+#include <stdint.h>
+#include <vector>
+
+class CommandQueue;
+class Mixer;
+class VoiceManager
+{
+public:
+	// how a clip competes for voices
+	struct ClipDesc
+	{
+		int32_t Clip;		// object store handle
+		int Priority;		// higher plays first when voices are short
+		int MaxVoices;		// of this clip at once
+		float Length;		// seconds a voice is held for
+		int Sound;			// mixer sound, or -1 to play on an AudioSource
+	};
+
+private:
+	struct Voice
+	{
+		int32_t Clip;
+		int Priority;
+		float EndTime;
+		int32_t MixerVoice;		// or 0 if it went to an AudioSource
+	};
+
+	struct Request
+	{
+		int32_t Slot;		// object slot with an AudioSource
+		int32_t Clip;
+		int Priority;
+		int Order;			// keeps equal priorities in the order asked
+	};
+
+	std::vector<ClipDesc> mClips;
+	std::vector<Voice> mVoices;			// one shots still playing, as far as we know
+	std::vector<Request> mRequests;		// this frame's
+	int mMaxVoices;
+	float mTime;
+	int mNumDropped;
+	int mNumStolen;
+	Mixer *mMixer;
+
+	const ClipDesc *FindClip(int32_t clip) const;
+	bool Steal(int priority);
+
+public:
+	explicit VoiceManager(int maxVoices);
+
+	void SetMixer(Mixer *mixer) { mMixer = mixer; }
+	void AddClip(const ClipDesc &desc);
+	void Play(int32_t slot, int32_t clip);
+	void Flush(float deltaTime, CommandQueue &commands);
+	void Clear();
+
+	int GetNumPlaying() const { return (int)mVoices.size(); }
+	int GetNumDropped() const { return mNumDropped; }
+	int GetNumStolen() const { return mNumStolen; }
+};
@@ -0,0 +1,182 @@
+//
+// implementation for reading and writing .wav files
+//
+
+#include "Wav.h"
+#include <string.h>
+
+static uint32_t ReadU32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t ReadU16(const uint8_t *p)
+{
+	return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static void WriteU32(uint8_t *p, uint32_t value)
+{
+	p[0] = (uint8_t)value;
+	p[1] = (uint8_t)(value >> 8);
+	p[2] = (uint8_t)(value >> 16);
+	p[3] = (uint8_t)(value >> 24);
+}
+
+static void WriteU16(uint8_t *p, uint16_t value)
+{
+	p[0] = (uint8_t)value;
+	p[1] = (uint8_t)(value >> 8);
+}
+
+//
+// walk the RIFF chunks for the format and the samples, convert them to
+// float and resample linearly. done once at load so mixing is just adds
+//
+bool DecodeWav(const std::vector<uint8_t> &file, int sampleRate, std::vector<float> &samples)
+{
+	const uint8_t *data = file.data();
+	size_t size = file.size();
+	if (size < 12 || memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0)
+		return false;
+
+	int channels = 0, rate = 0, bits = 0;
+	const uint8_t *pcm = nullptr;
+	uint32_t pcmSize = 0;
+	size_t pos = 12;
+	while (pos + 8 <= size)
+	{
+		uint32_t chunkSize = ReadU32(data + pos + 4);
+		const uint8_t *chunk = data + pos + 8;
+		if (chunkSize > size - pos - 8)
+			chunkSize = (uint32_t)(size - pos - 8);
+
+		if (memcmp(data + pos, "fmt ", 4) == 0 && chunkSize >= 16)
+		{
+			if (ReadU16(chunk) != 1)
+				return false;	// not PCM
+			channels = ReadU16(chunk + 2);
+			rate = (int)ReadU32(chunk + 4);
+			bits = ReadU16(chunk + 14);
+		}
+		else if (memcmp(data + pos, "data", 4) == 0)
+		{
+			pcm = chunk;
+			pcmSize = chunkSize;
+		}
+		pos += 8 + chunkSize + (chunkSize & 1);
+	}
+	if (!pcm || (channels != 1 && channels != 2) || (bits != 8 && bits != 16) || rate <= 0)
+		return false;
+
+	int bytesPerFrame = channels * bits / 8;
+	int numFrames = (int)(pcmSize / bytesPerFrame);
+	std::vector<float> source(numFrames * 2);
+	int i;
+	for (i = 0; i < numFrames; i++)
+	{
+		const uint8_t *frame = pcm + i * bytesPerFrame;
+		float left, right;
+		if (bits == 8)
+		{
+			left = (frame[0] - 128) / 128.0f;
+			right = channels == 2 ? (frame[1] - 128) / 128.0f : left;
+		}
+		else
+		{
+			left = (int16_t)ReadU16(frame) / 32768.0f;
+			right = channels == 2 ? (int16_t)ReadU16(frame + 2) / 32768.0f : left;
+		}
+		source[i * 2] = left;
+		source[i * 2 + 1] = right;
+	}
+
+	if (rate == sampleRate || numFrames == 0)
+	{
+		samples.swap(source);
+		return true;
+	}
+
+	ResampleStereo(source.data(), numFrames, rate, sampleRate, samples);
+	return true;
+}
+
+void ResampleStereo(const float *source, int numFrames, int rate, int sampleRate, std::vector<float> &samples)
+{
+	double step = (double)rate / sampleRate;
+	int outFrames = (int)(numFrames / step);
+	samples.resize(outFrames * 2);
+	int i;
+	for (i = 0; i < outFrames; i++)
+	{
+		double at = i * step;
+		int a = (int)at;
+		int b = a + 1 < numFrames ? a + 1 : a;
+		float t = (float)(at - a);
+		samples[i * 2] = source[a * 2] + (source[b * 2] - source[a * 2]) * t;
+		samples[i * 2 + 1] = source[a * 2 + 1] + (source[b * 2 + 1] - source[a * 2 + 1]) * t;
+	}
+}
+
+bool WavWriter::Open(const char *path, int sampleRate)
+{
+	Close();
+	mFile = fopen(path, "wb");
+	if (!mFile)
+		return false;
+
+	mSampleRate = sampleRate;
+	mNumFrames = 0;
+	WriteHeader();
+	return true;
+}
+
+//
+// 16 bit stereo, the header's sizes are filled in again on Close
+//
+void WavWriter::WriteHeader()
+{
+	uint32_t dataSize = mNumFrames * 4;
+	uint8_t header[44];
+	memcpy(header, "RIFF", 4);
+	WriteU32(header + 4, 36 + dataSize);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	WriteU32(header + 16, 16);
+	WriteU16(header + 20, 1);
+	WriteU16(header + 22, 2);
+	WriteU32(header + 24, mSampleRate);
+	WriteU32(header + 28, mSampleRate * 4);
+	WriteU16(header + 32, 4);
+	WriteU16(header + 34, 16);
+	memcpy(header + 36, "data", 4);
+	WriteU32(header + 40, dataSize);
+	fwrite(header, 1, sizeof(header), mFile);
+}
+
+void WavWriter::Write(const float *samples, int frames)
+{
+	if (!mFile)
+		return;
+
+	mBuffer.resize(frames * 2);
+	int i;
+	for (i = 0; i < frames * 2; i++)
+	{
+		float s = samples[i] * 32767.0f;
+		s = s > 32767.0f ? 32767.0f : (s < -32768.0f ? -32768.0f : s);
+		mBuffer[i] = (int16_t)s;
+	}
+	fwrite(mBuffer.data(), sizeof(int16_t), mBuffer.size(), mFile);
+	mNumFrames += frames;
+}
+
+void WavWriter::Close()
+{
+	if (!mFile)
+		return;
+
+	fseek(mFile, 0, SEEK_SET);
+	WriteHeader();
+	fclose(mFile);
+	mFile = nullptr;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+//
+// just enough of the .wav format for the mixer. reads 8 and 16 bit PCM,
+// mono or stereo, and writes 16 bit stereo for recording headless runs
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+// decode a whole .wav file to interleaved stereo floats, resampled to
+// sampleRate. false if it isn't PCM the mixer can use
+bool DecodeWav(const std::vector<uint8_t> &file, int sampleRate, std::vector<float> &samples);
+
+// linear resample of numFrames interleaved stereo frames
+void ResampleStereo(const float *source, int numFrames, int rate, int sampleRate, std::vector<float> &samples);
+
+class WavWriter
+{
+private:
+	FILE *mFile;
+	int mSampleRate;
+	uint32_t mNumFrames;
+	std::vector<int16_t> mBuffer;
+
+	void WriteHeader();
+
+public:
+	WavWriter() : mFile(nullptr), mSampleRate(0), mNumFrames(0) {}
+	~WavWriter() { Close(); }
+
+	bool Open(const char *path, int sampleRate);
+	void Write(const float *samples, int frames);	// interleaved stereo
+	void Close();
+};
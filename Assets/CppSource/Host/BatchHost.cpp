@@ -0,0 +1,110 @@
+//
+// runs a batch of headless worlds from the command line, no Unity needed.
+// everything comes from the asset pack the asset_pack target builds
+//
+//	BatchHost <pack> [--worlds n] [--frames n] [--seed n] [--workers n] [--audio dir]
+//		[--mode classic|fragments|stress]
+//
+// world i gets seed + i. prints a line of stats per world. stress mode is
+// the fragment stress scenario driven by BatchRunner::StressScript, for
+// benchmarking the simulation with the field full of rocks
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "BatchRunner.h"
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+static int Usage()
+{
+	fprintf(stderr, "usage: BatchHost <pack> [--worlds n] [--frames n] [--seed n] [--workers n] [--audio dir]\n"
+		"\t[--mode classic|fragments|stress]\n");
+	return 2;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+		return Usage();
+
+	const char *packPath = argv[1];
+	int numWorlds = 8;
+	int numFrames = 60 * 60;
+	uint32_t firstSeed = 1;
+	int numWorkers = (int)std::thread::hardware_concurrency();
+	const char *audioDirectory = nullptr;
+	Game::Mode mode = Game::ModeClassic;
+
+	int i;
+	for (i = 2; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "--worlds") == 0)
+			numWorlds = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "--frames") == 0)
+			numFrames = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "--seed") == 0)
+			firstSeed = (uint32_t)strtoul(argv[i + 1], nullptr, 10);
+		else if (strcmp(argv[i], "--workers") == 0)
+			numWorkers = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "--audio") == 0)
+			audioDirectory = argv[i + 1];
+		else if (strcmp(argv[i], "--mode") == 0 && strcmp(argv[i + 1], "classic") == 0)
+			mode = Game::ModeClassic;
+		else if (strcmp(argv[i], "--mode") == 0 && strcmp(argv[i + 1], "fragments") == 0)
+			mode = Game::ModeFragments;
+		else if (strcmp(argv[i], "--mode") == 0 && strcmp(argv[i + 1], "stress") == 0)
+			mode = Game::ModeFragmentStress;
+		else
+			return Usage();
+	}
+	if (i != argc || numWorlds <= 0 || numFrames <= 0)
+		return Usage();
+
+	Game source(true);
+	if (source.LoadHeadless(packPath) != 0)
+	{
+		fprintf(stderr, "Couldn't load %s\n", packPath);
+		return 1;
+	}
+
+	std::vector<uint32_t> seeds;
+	for (i = 0; i < numWorlds; i++)
+	{
+		seeds.push_back(firstSeed + i);
+	}
+
+	BatchRunner runner(numWorkers);
+	runner.SetMode(mode);
+	if (audioDirectory)
+	{
+		runner.SetAudioDirectory(audioDirectory);
+	}
+	std::vector<BatchRunner::Result> results;
+	BatchRunner::InputScript script = BatchRunner::SweepScript(120);
+	if (mode == Game::ModeFragmentStress)
+	{
+		script = BatchRunner::StressScript();
+	}
+	runner.Run(source, seeds, numFrames, 1.0f / 60, script, results);
+
+	int numErrors = 0;
+	printf("seed\trocks\taliens\thits\tsplit\tpeak\tmean ms\tworst ms\n");
+	for (i = 0; i < (int)results.size(); i++)
+	{
+		const BatchRunner::Result &result = results[i];
+		printf("%u\t%d\t%d\t%d\t%d\t%d\t%.3f\t%.3f\n", result.Seed, result.Stats.RocksDestroyed,
+			result.Stats.AliensDestroyed, result.Stats.ShipHits, result.Stats.RocksSplit, result.Stats.PeakRocks,
+			result.MeanStepMs, result.WorstStepMs);
+		numErrors += result.SpriteErrors;
+	}
+	if (numErrors > 0)
+	{
+		fprintf(stderr, "%d bad sprite frames\n", numErrors);
+		return 1;
+	}
+	return 0;
+}
@@ -30,6 +30,18 @@
 #include <new>
 void* operator new(size_t, void* p);
 
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+	// For the deferred release queue
+	#include <algorithm>
+	#include <mutex>
+	#include <vector>
+	
+	// For _InterlockedIncrement(), etc.
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
 // Macro to put before functions that need to be exposed to C#
 #ifdef _WIN32
 	#define DLLEXPORT extern "C" __declspec(dllexport)
@@ -48,6 +60,8 @@ namespace Plugin
 	void (*SetException)(int32_t handle);
 	int32_t (*ArrayGetLength)(int32_t handle);
 	int32_t (*EnumerableGetEnumerator)(int32_t handle);
+	void* (*ArrayPin)(int32_t handle, int32_t byteOffset, int32_t byteCount, void** address);
+	void (*ArrayUnpin)(void* pin);
 	
 	/*BEGIN FUNCTION POINTERS*/
 	void (*ReleaseSystemDecimal)(int32_t handle);
@@ -95,6 +109,8 @@ namespace Plugin
 	int32_t (*UnityEngineGameObjectMethodCompareTagSystemString)(int32_t thisHandle, int32_t tagHandle);
 	int32_t (*UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveType)(UnityEngine::PrimitiveType type);
 	void (*UnityEngineDebugMethodLogSystemObject)(int32_t messageHandle);
+	void (*UnityEngineDebugMethodLogWarningSystemObject)(int32_t messageHandle);
+	void (*UnityEngineDebugMethodLogErrorSystemObject)(int32_t messageHandle);
 	int32_t (*UnityEngineAudioClipConstructor)();
 	int32_t (*UnityEngineAudioSourcePropertyGetLoop)(int32_t thisHandle);
 	void (*UnityEngineAudioSourcePropertySetLoop)(int32_t thisHandle, uint32_t value);
@@ -120,6 +136,33 @@ namespace Plugin
 	void (*UnityEngineSpriteRendererPropertySetSprite)(int32_t thisHandle, int32_t valueHandle);
 	int32_t (*UnityEngineSpriteRendererPropertyGetBounds)(int32_t thisHandle);
 	System::Single (*UnityEngineTimePropertyGetDeltaTime)();
+	void (*MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32)(int32_t archetype, int32_t nameHandle, int32_t flags);
+	System::Int32 (*MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32)(void* handles, int32_t count);
+	void (*MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32)(void* commands, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32)(int32_t formatHandle, int32_t first, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodLoadSpritesSystemString)(int32_t manifestHandle);
+	System::Int32 (*MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtr)(int32_t manifestHandle, void* handles);
+	System::Int32 (*MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32)(int32_t formatHandle, int32_t first, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodLoadSpritesAsyncSystemString)(int32_t manifestHandle);
+	System::Int32 (*MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtr)(int32_t manifestHandle, void* handles);
+	System::Single (*MyGameNativeBatchMethodPollLoads)();
+	void (*MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32)(void* commands, int32_t count);
+	void (*MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32)(void* bounds, int32_t first, int32_t count);
+	void (*MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32)(void* descriptors, int32_t count);
+	void (*MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32)(void* slots, int32_t count);
+	void (*MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32)(void* commands, int32_t count);
+	void (*MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32)(void* handles, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32)(void* uvs, int32_t first, int32_t count);
+	void (*MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32)(void* layers, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32)(int32_t pathHandle, int32_t formatHandle, int32_t first, int32_t count);
+	void (*MyGameNativeBatchMethodGetViewRectSystemIntPtr)(void* rect);
+	void (*MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32)(void* handles, void* lengths, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32)(void* buffer, int32_t size);
+	System::Int32 (*MyGameNativeBatchMethodGetOutputSampleRate)();
+	void (*MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32)(void* ring, int32_t frames);
+	System::Int32 (*MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32)(void* buffer, int32_t size);
+	System::Int32 (*MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32)(void* pixels, int32_t width, int32_t height, void* frames, int32_t count);
+	System::Int32 (*MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32)(int32_t frames, int32_t sampleRate);
 	void (*ReleaseBaseGameScript)(int32_t handle);
 	void (*BaseGameScriptConstructor)(int32_t cppHandle, int32_t* handle);
 	int32_t (*BoxBoolean)(uint32_t val);
@@ -146,6 +189,10 @@ namespace Plugin
 	System::Single (*UnboxSingle)(int32_t valHandle);
 	int32_t (*BoxDouble)(double val);
 	System::Double (*UnboxDouble)(int32_t valHandle);
+	int32_t (*SystemSystemSingleArray2Constructor2)(int32_t length0, int32_t length1);
+	int32_t (*SystemSystemSingleArray2GetLength2)(int32_t thisHandle, int32_t dimension);
+	System::Single (*SystemSingleArray2GetItem2)(int32_t thisHandle, int32_t index0, int32_t index1);
+	int32_t (*SystemSingleArray2SetItem2)(int32_t thisHandle, int32_t index0, int32_t index1, float item);
 	/*END FUNCTION POINTERS*/
 }
 
@@ -870,6 +917,156 @@ System::Decimal operator"" _m(unsigned long long x)
 
 namespace Plugin
 {
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+	// Set by Init
+	thread_local bool isMainThread = false;
+
+	// A release that happened off the main thread
+	struct DeferredRelease
+	{
+		int32_t* RefCount;
+		void (*Release)(int32_t handle);
+		int32_t Handle;
+	};
+	
+	// Added to a reference count in place of the last reference when
+	// that goes off the main thread. Until FlushDeferredReleases takes
+	// it off again the count can't reach zero, so the main thread can't
+	// release the handle while the release is still queued.
+	const int32_t PendingRelease = 0x40000000;
+
+	std::mutex deferredReleasesLock;
+	std::vector<DeferredRelease> deferredReleases;
+	std::vector<DeferredRelease> flushingReleases;
+#endif
+
+	bool IsMainThread()
+	{
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+		return isMainThread;
+#else
+		return true;
+#endif
+	}
+
+	int32_t IncrementRefCount(int32_t* refCount)
+	{
+#if defined(NATIVE_SCRIPT_THREAD_SAFE) && defined(_MSC_VER)
+		return _InterlockedIncrement((volatile long*)refCount);
+#elif defined(NATIVE_SCRIPT_THREAD_SAFE)
+		return __atomic_add_fetch(refCount, 1, __ATOMIC_RELAXED);
+#else
+		return ++*refCount;
+#endif
+	}
+
+	int32_t LoadRefCount(int32_t* refCount)
+	{
+#if defined(NATIVE_SCRIPT_THREAD_SAFE) && defined(_MSC_VER)
+		return _InterlockedOr((volatile long*)refCount, 0);
+#elif defined(NATIVE_SCRIPT_THREAD_SAFE)
+		return __atomic_load_n(refCount, __ATOMIC_ACQUIRE);
+#else
+		return *refCount;
+#endif
+	}
+	
+	int32_t AddRefCount(int32_t* refCount, int32_t amount)
+	{
+#if defined(NATIVE_SCRIPT_THREAD_SAFE) && defined(_MSC_VER)
+		return _InterlockedExchangeAdd((volatile long*)refCount, amount) + amount;
+#elif defined(NATIVE_SCRIPT_THREAD_SAFE)
+		return __atomic_add_fetch(refCount, amount, __ATOMIC_ACQ_REL);
+#else
+		return *refCount += amount;
+#endif
+	}
+	
+	bool CompareExchangeRefCount(int32_t* refCount, int32_t expected, int32_t desired)
+	{
+#if defined(NATIVE_SCRIPT_THREAD_SAFE) && defined(_MSC_VER)
+		return _InterlockedCompareExchange((volatile long*)refCount, desired, expected) == expected;
+#elif defined(NATIVE_SCRIPT_THREAD_SAFE)
+		return __atomic_compare_exchange_n(refCount, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#else
+		if (*refCount != expected)
+		{
+			return false;
+		}
+		*refCount = desired;
+		return true;
+#endif
+	}
+	
+	// Returns the references left. Off the main thread the last one is
+	// swapped for PendingRelease in the same step and 0 is returned, so
+	// the caller queues the release.
+	int32_t DecrementRefCount(int32_t* refCount)
+	{
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+		if (!isMainThread)
+		{
+			for (;;)
+			{
+				int32_t count = LoadRefCount(refCount);
+				if (count != 1)
+				{
+					return AddRefCount(refCount, -1);
+				}
+				if (CompareExchangeRefCount(refCount, 1, PendingRelease))
+				{
+					return 0;
+				}
+			}
+		}
+#endif
+		return AddRefCount(refCount, -1);
+	}
+
+	// Release an object whose reference count just reached zero. Off
+	// the main thread the release waits for FlushDeferredReleases.
+	void ReleaseManaged(
+		int32_t* refCount,
+		void (*release)(int32_t handle),
+		int32_t handle)
+	{
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+		if (!isMainThread)
+		{
+			DeferredRelease deferred = { refCount, release, handle };
+			std::lock_guard<std::mutex> lock(deferredReleasesLock);
+			deferredReleases.push_back(deferred);
+			return;
+		}
+#endif
+		release(handle);
+	}
+
+	void FlushDeferredReleases()
+	{
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+		assert(isMainThread);
+		{
+			std::lock_guard<std::mutex> lock(deferredReleasesLock);
+			flushingReleases.swap(deferredReleases);
+		}
+		
+		// Each handle is queued once while its PendingRelease is on the
+		// count. Take that off, and release only if nothing referenced
+		// the handle again since. Otherwise its last reference releases
+		// it as usual.
+		for (size_t i = 0; i < flushingReleases.size(); ++i)
+		{
+			DeferredRelease& deferred = flushingReleases[i];
+			if (AddRefCount(deferred.RefCount, -PendingRelease) == 0)
+			{
+				deferred.Release(deferred.Handle);
+			}
+		}
+		flushingReleases.clear();
+#endif
+	}
+
 	int32_t RefCountsLenClass;
 	int32_t* RefCountsClass;
 
@@ -878,7 +1075,7 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenClass);
 		if (handle != 0)
 		{
-			RefCountsClass[handle]++;
+			IncrementRefCount(&RefCountsClass[handle]);
 		}
 	}
 
@@ -887,10 +1084,10 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenClass);
 		if (handle != 0)
 		{
-			int32_t numRemain = --RefCountsClass[handle];
+			int32_t numRemain = DecrementRefCount(&RefCountsClass[handle]);
 			if (numRemain == 0)
 			{
-				ReleaseObject(handle);
+				ReleaseManaged(&RefCountsClass[handle], ReleaseObject, handle);
 			}
 		}
 	}
@@ -900,7 +1097,7 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenClass);
 		if (handle != 0)
 		{
-			int32_t numRemain = --RefCountsClass[handle];
+			int32_t numRemain = DecrementRefCount(&RefCountsClass[handle]);
 			if (numRemain == 0)
 			{
 				return true;
@@ -918,7 +1115,7 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenSystemDecimal);
 		if (handle != 0)
 		{
-			RefCountsSystemDecimal[handle]++;
+			IncrementRefCount(&RefCountsSystemDecimal[handle]);
 		}
 	}
 	
@@ -927,10 +1124,10 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenSystemDecimal);
 		if (handle != 0)
 		{
-			int32_t numRemain = --RefCountsSystemDecimal[handle];
+			int32_t numRemain = DecrementRefCount(&RefCountsSystemDecimal[handle]);
 			if (numRemain == 0)
 			{
-				ReleaseSystemDecimal(handle);
+				ReleaseManaged(&RefCountsSystemDecimal[handle], ReleaseSystemDecimal, handle);
 			}
 		}
 	}
@@ -943,7 +1140,7 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenUnityEngineBounds);
 		if (handle != 0)
 		{
-			RefCountsUnityEngineBounds[handle]++;
+			IncrementRefCount(&RefCountsUnityEngineBounds[handle]);
 		}
 	}
 	
@@ -952,10 +1149,10 @@ namespace Plugin
 		assert(handle >= 0 && handle < RefCountsLenUnityEngineBounds);
 		if (handle != 0)
 		{
-			int32_t numRemain = --RefCountsUnityEngineBounds[handle];
+			int32_t numRemain = DecrementRefCount(&RefCountsUnityEngineBounds[handle]);
 			if (numRemain == 0)
 			{
-				ReleaseUnityEngineBounds(handle);
+				ReleaseManaged(&RefCountsUnityEngineBounds[handle], ReleaseUnityEngineBounds, handle);
 			}
 		}
 	}
@@ -1021,8 +1218,13 @@ namespace Plugin
 
 namespace Plugin
 {
-	// An unhandled exception caused by C++ calling into C#
+	// An unhandled exception caused by C++ calling into C#. Each
+	// thread has its own when bindings are thread safe.
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+	thread_local System::Exception* unhandledCsharpException = nullptr;
+#else
 	System::Exception* unhandledCsharpException = nullptr;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1259,6 +1461,46 @@ namespace System
 	{
 		return 0;
 	}
+	
+	void Array::CopyToRaw(void* destination, int32_t byteOffset, int32_t byteCount)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		void* address;
+		void* pin = Plugin::ArrayPin(Handle, byteOffset, byteCount, &address);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		assert(pin != nullptr);
+		if (pin)
+		{
+			memcpy(destination, address, byteCount);
+			Plugin::ArrayUnpin(pin);
+		}
+	}
+	
+	void Array::CopyFromRaw(const void* source, int32_t byteOffset, int32_t byteCount)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		void* address;
+		void* pin = Plugin::ArrayPin(Handle, byteOffset, byteCount, &address);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		assert(pin != nullptr);
+		if (pin)
+		{
+			memcpy(address, source, byteCount);
+			Plugin::ArrayUnpin(pin);
+		}
+	}
 }
 
 /*BEGIN METHOD DEFINITIONS*/
@@ -1531,7 +1773,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Boolean>::~IEquatable_1<System::Boolean>()
+	IEquatable_1<System::Boolean>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -1612,7 +1854,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Char>::~IEquatable_1<System::Char>()
+	IEquatable_1<System::Char>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -1693,7 +1935,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::SByte>::~IEquatable_1<System::SByte>()
+	IEquatable_1<System::SByte>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -1774,7 +2016,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Byte>::~IEquatable_1<System::Byte>()
+	IEquatable_1<System::Byte>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -1855,7 +2097,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Int16>::~IEquatable_1<System::Int16>()
+	IEquatable_1<System::Int16>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -1936,7 +2178,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::UInt16>::~IEquatable_1<System::UInt16>()
+	IEquatable_1<System::UInt16>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2017,7 +2259,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Int32>::~IEquatable_1<System::Int32>()
+	IEquatable_1<System::Int32>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2098,7 +2340,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::UInt32>::~IEquatable_1<System::UInt32>()
+	IEquatable_1<System::UInt32>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2179,7 +2421,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Int64>::~IEquatable_1<System::Int64>()
+	IEquatable_1<System::Int64>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2260,7 +2502,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::UInt64>::~IEquatable_1<System::UInt64>()
+	IEquatable_1<System::UInt64>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2341,7 +2583,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Single>::~IEquatable_1<System::Single>()
+	IEquatable_1<System::Single>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2422,7 +2664,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Double>::~IEquatable_1<System::Double>()
+	IEquatable_1<System::Double>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2503,7 +2745,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Decimal>::~IEquatable_1<System::Decimal>()
+	IEquatable_1<System::Decimal>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2584,7 +2826,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>::~IEquatable_1<UnityEngine::Vector3>()
+	IEquatable_1<UnityEngine::Vector3>::~IEquatable_1()
 	{
 		if (Handle)
 		{
@@ -2665,7 +2907,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Boolean>::~IComparable_1<System::Boolean>()
+	IComparable_1<System::Boolean>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -2746,7 +2988,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Char>::~IComparable_1<System::Char>()
+	IComparable_1<System::Char>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -2827,7 +3069,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::SByte>::~IComparable_1<System::SByte>()
+	IComparable_1<System::SByte>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -2908,7 +3150,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Byte>::~IComparable_1<System::Byte>()
+	IComparable_1<System::Byte>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -2989,7 +3231,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Int16>::~IComparable_1<System::Int16>()
+	IComparable_1<System::Int16>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3070,7 +3312,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::UInt16>::~IComparable_1<System::UInt16>()
+	IComparable_1<System::UInt16>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3151,7 +3393,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Int32>::~IComparable_1<System::Int32>()
+	IComparable_1<System::Int32>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3232,7 +3474,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::UInt32>::~IComparable_1<System::UInt32>()
+	IComparable_1<System::UInt32>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3313,7 +3555,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Int64>::~IComparable_1<System::Int64>()
+	IComparable_1<System::Int64>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3394,7 +3636,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::UInt64>::~IComparable_1<System::UInt64>()
+	IComparable_1<System::UInt64>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3475,7 +3717,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Single>::~IComparable_1<System::Single>()
+	IComparable_1<System::Single>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3556,7 +3798,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Double>::~IComparable_1<System::Double>()
+	IComparable_1<System::Double>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3637,7 +3879,7 @@ namespace System
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Decimal>::~IComparable_1<System::Decimal>()
+	IComparable_1<System::Decimal>::~IComparable_1()
 	{
 		if (Handle)
 		{
@@ -3774,6 +4016,7 @@ namespace System
 	
 	System::Decimal::Decimal(System::Double value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::SystemDecimalConstructorSystemDouble(value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3791,6 +4034,7 @@ namespace System
 	
 	System::Decimal::Decimal(System::UInt64 value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::SystemDecimalConstructorSystemUInt64(value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3808,6 +4052,7 @@ namespace System
 	
 	System::Decimal::operator System::ValueType()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3826,6 +4071,7 @@ namespace System
 	
 	System::Decimal::operator System::Object()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3844,6 +4090,7 @@ namespace System
 	
 	System::Decimal::operator System::IFormattable()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3862,6 +4109,7 @@ namespace System
 	
 	System::Decimal::operator System::IConvertible()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3880,6 +4128,7 @@ namespace System
 	
 	System::Decimal::operator System::IComparable()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3898,6 +4147,7 @@ namespace System
 	
 	System::Decimal::operator System::IComparable_1<System::Decimal>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3916,6 +4166,7 @@ namespace System
 	
 	System::Decimal::operator System::IEquatable_1<System::Decimal>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxDecimal(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3937,6 +4188,7 @@ namespace System
 {
 	System::Object::operator System::Decimal()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Decimal returnVal(Plugin::InternalUse::Only, Plugin::UnboxDecimal(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3957,6 +4209,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3::Vector3(System::Single x, System::Single y, System::Single z)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3ConstructorSystemSingle_SystemSingle_SystemSingle(x, y, z);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3970,6 +4223,7 @@ namespace UnityEngine
 	
 	System::Single UnityEngine::Vector3::GetMagnitude()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3PropertyGetMagnitude(this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3983,6 +4237,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Vector3::operator+(UnityEngine::Vector3& a)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3Methodop_AdditionUnityEngineVector3_UnityEngineVector3(*this, a);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -3996,6 +4251,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Vector3::operator-(UnityEngine::Vector3& a)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3Methodop_SubtractionUnityEngineVector3_UnityEngineVector3(*this, a);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4009,6 +4265,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Vector3::Normalize(UnityEngine::Vector3& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3MethodNormalizeUnityEngineVector3(value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4022,6 +4279,7 @@ namespace UnityEngine
 	
 	System::Single UnityEngine::Vector3::Dot(UnityEngine::Vector3& lhs, UnityEngine::Vector3& rhs)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3MethodDotUnityEngineVector3_UnityEngineVector3(lhs, rhs);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4035,6 +4293,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Vector3::Cross(UnityEngine::Vector3& lhs, UnityEngine::Vector3& rhs)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3MethodCrossUnityEngineVector3_UnityEngineVector3(lhs, rhs);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4048,6 +4307,7 @@ namespace UnityEngine
 	
 	System::Single UnityEngine::Vector3::Distance(UnityEngine::Vector3& a, UnityEngine::Vector3& b)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineVector3MethodDistanceUnityEngineVector3_UnityEngineVector3(a, b);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4061,6 +4321,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3::operator System::ValueType()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxVector3(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4079,6 +4340,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3::operator System::Object()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxVector3(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4100,6 +4362,7 @@ namespace System
 {
 	System::Object::operator UnityEngine::Vector3()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		UnityEngine::Vector3 returnVal(Plugin::UnboxVector3(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4194,6 +4457,7 @@ namespace UnityEngine
 	
 	System::String UnityEngine::Object::GetName()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineObjectPropertyGetName(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4207,6 +4471,7 @@ namespace UnityEngine
 	
 	void UnityEngine::Object::SetName(System::String& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineObjectPropertySetName(Handle, value.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4219,6 +4484,7 @@ namespace UnityEngine
 	
 	void UnityEngine::Object::Destroy(UnityEngine::Object& obj)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineObjectMethodDestroyUnityEngineObject(obj.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4314,6 +4580,7 @@ namespace UnityEngine
 	
 	UnityEngine::Transform UnityEngine::Component::GetTransform()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineComponentPropertyGetTransform(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4327,6 +4594,7 @@ namespace UnityEngine
 	
 	UnityEngine::GameObject UnityEngine::Component::GetGameObject()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineComponentPropertyGetGameObject(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4427,6 +4695,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Transform::GetPosition()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineTransformPropertyGetPosition(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4440,6 +4709,7 @@ namespace UnityEngine
 	
 	void UnityEngine::Transform::SetPosition(UnityEngine::Vector3& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineTransformPropertySetPosition(Handle, value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4535,6 +4805,7 @@ namespace System
 		
 		System::Object System::Collections::IEnumerator::GetCurrent()
 		{
+			NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 			auto returnValue = Plugin::SystemCollectionsIEnumeratorPropertyGetCurrent(Handle);
 			if (Plugin::unhandledCsharpException)
 			{
@@ -4548,6 +4819,7 @@ namespace System
 		
 		System::Boolean System::Collections::IEnumerator::MoveNext()
 		{
+			NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 			auto returnValue = Plugin::SystemCollectionsIEnumeratorMethodMoveNext(Handle);
 			if (Plugin::unhandledCsharpException)
 			{
@@ -4902,6 +5174,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Bounds::GetMax()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineBoundsPropertyGetMax(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4915,6 +5188,7 @@ namespace UnityEngine
 	
 	void UnityEngine::Bounds::SetMax(UnityEngine::Vector3& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineBoundsPropertySetMax(Handle, value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4927,6 +5201,7 @@ namespace UnityEngine
 	
 	UnityEngine::Vector3 UnityEngine::Bounds::GetMin()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineBoundsPropertyGetMin(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4940,6 +5215,7 @@ namespace UnityEngine
 	
 	void UnityEngine::Bounds::SetMin(UnityEngine::Vector3& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineBoundsPropertySetMin(Handle, value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4952,6 +5228,7 @@ namespace UnityEngine
 	
 	System::Boolean UnityEngine::Bounds::Intersects(UnityEngine::Bounds& bounds)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineBoundsMethodIntersectsUnityEngineBounds(Handle, bounds.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4965,6 +5242,7 @@ namespace UnityEngine
 	
 	UnityEngine::Bounds::operator System::ValueType()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxBounds(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -4983,6 +5261,7 @@ namespace UnityEngine
 	
 	UnityEngine::Bounds::operator System::Object()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxBounds(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5004,6 +5283,7 @@ namespace System
 {
 	System::Object::operator UnityEngine::Bounds()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		UnityEngine::Bounds returnVal(Plugin::InternalUse::Only, Plugin::UnboxBounds(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5101,6 +5381,7 @@ namespace UnityEngine
 	UnityEngine::GameObject::GameObject()
 		: UnityEngine::Object(nullptr)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectConstructor();
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5119,6 +5400,7 @@ namespace UnityEngine
 	UnityEngine::GameObject::GameObject(System::String& name)
 		: UnityEngine::Object(nullptr)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectConstructorSystemString(name.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5136,6 +5418,7 @@ namespace UnityEngine
 	
 	UnityEngine::Transform UnityEngine::GameObject::GetTransform()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectPropertyGetTransform(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5149,6 +5432,7 @@ namespace UnityEngine
 	
 	System::String UnityEngine::GameObject::GetTag()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectPropertyGetTag(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5162,6 +5446,7 @@ namespace UnityEngine
 	
 	void UnityEngine::GameObject::SetTag(System::String& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineGameObjectPropertySetTag(Handle, value.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5174,6 +5459,7 @@ namespace UnityEngine
 	
 	template<> MyGame::BaseGameScript UnityEngine::GameObject::AddComponent<MyGame::BaseGameScript>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodAddComponentMyGameBaseGameScript(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5187,6 +5473,7 @@ namespace UnityEngine
 	
 	template<> UnityEngine::SpriteRenderer UnityEngine::GameObject::AddComponent<UnityEngine::SpriteRenderer>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodAddComponentUnityEngineSpriteRenderer(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5200,6 +5487,7 @@ namespace UnityEngine
 	
 	template<> UnityEngine::AudioSource UnityEngine::GameObject::AddComponent<UnityEngine::AudioSource>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodAddComponentUnityEngineAudioSource(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5213,6 +5501,7 @@ namespace UnityEngine
 	
 	template<> UnityEngine::SpriteRenderer UnityEngine::GameObject::GetComponent<UnityEngine::SpriteRenderer>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodGetComponentUnityEngineSpriteRenderer(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5226,6 +5515,7 @@ namespace UnityEngine
 	
 	template<> UnityEngine::AudioSource UnityEngine::GameObject::GetComponent<UnityEngine::AudioSource>()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodGetComponentUnityEngineAudioSource(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5239,6 +5529,7 @@ namespace UnityEngine
 	
 	System::Boolean UnityEngine::GameObject::CompareTag(System::String& tag)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodCompareTagSystemString(Handle, tag.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5252,6 +5543,7 @@ namespace UnityEngine
 	
 	UnityEngine::GameObject UnityEngine::GameObject::CreatePrimitive(UnityEngine::PrimitiveType type)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveType(type);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5346,6 +5638,7 @@ namespace UnityEngine
 	
 	void UnityEngine::Debug::Log(System::Object& message)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineDebugMethodLogSystemObject(message.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5355,6 +5648,32 @@ namespace UnityEngine
 			delete ex;
 		}
 	}
+	
+	void UnityEngine::Debug::LogWarning(System::Object& message)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::UnityEngineDebugMethodLogWarningSystemObject(message.Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void UnityEngine::Debug::LogError(System::Object& message)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::UnityEngineDebugMethodLogErrorSystemObject(message.Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
 }
 
 namespace UnityEngine
@@ -5442,6 +5761,7 @@ namespace UnityEngine
 	UnityEngine::AudioClip::AudioClip()
 		: UnityEngine::Object(nullptr)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineAudioClipConstructor();
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5546,6 +5866,7 @@ namespace UnityEngine
 	
 	System::Boolean UnityEngine::AudioSource::GetLoop()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineAudioSourcePropertyGetLoop(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5559,6 +5880,7 @@ namespace UnityEngine
 	
 	void UnityEngine::AudioSource::SetLoop(System::Boolean value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineAudioSourcePropertySetLoop(Handle, value);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5571,6 +5893,7 @@ namespace UnityEngine
 	
 	UnityEngine::AudioClip UnityEngine::AudioSource::GetClip()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineAudioSourcePropertyGetClip(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5584,6 +5907,7 @@ namespace UnityEngine
 	
 	void UnityEngine::AudioSource::SetClip(UnityEngine::AudioClip& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineAudioSourcePropertySetClip(Handle, value.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5596,6 +5920,7 @@ namespace UnityEngine
 	
 	void UnityEngine::AudioSource::PlayOneShot(UnityEngine::AudioClip& clip)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineAudioSourceMethodPlayOneShotUnityEngineAudioClip(Handle, clip.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5608,6 +5933,7 @@ namespace UnityEngine
 	
 	void UnityEngine::AudioSource::Play()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineAudioSourceMethodPlay(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5620,6 +5946,7 @@ namespace UnityEngine
 	
 	void UnityEngine::AudioSource::Stop()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineAudioSourceMethodStop(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5713,6 +6040,7 @@ namespace UnityEngine
 	
 	System::Single UnityEngine::Input::GetAxis(System::String& axisName)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineInputMethodGetAxisSystemString(axisName.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5726,6 +6054,7 @@ namespace UnityEngine
 	
 	System::Single UnityEngine::Input::GetAxisRaw(System::String& axisName)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineInputMethodGetAxisRawSystemString(axisName.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5739,6 +6068,7 @@ namespace UnityEngine
 	
 	System::Boolean UnityEngine::Input::GetKey(System::String& name)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineInputMethodGetKeySystemString(name.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5752,6 +6082,7 @@ namespace UnityEngine
 	
 	System::Boolean UnityEngine::Input::GetKeyUp(System::String& name)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineInputMethodGetKeyUpSystemString(name.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5765,6 +6096,7 @@ namespace UnityEngine
 	
 	System::Boolean UnityEngine::Input::GetKeyDown(System::String& name)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineInputMethodGetKeyDownSystemString(name.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5859,6 +6191,7 @@ namespace UnityEngine
 	
 	template<> UnityEngine::Sprite UnityEngine::Resources::Load<UnityEngine::Sprite>(System::String& path)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineResourcesMethodLoadUnityEngineSpriteSystemString(path.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5872,6 +6205,7 @@ namespace UnityEngine
 	
 	template<> UnityEngine::AudioClip UnityEngine::Resources::Load<UnityEngine::AudioClip>(System::String& path)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineResourcesMethodLoadUnityEngineAudioClipSystemString(path.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -5972,6 +6306,7 @@ namespace UnityEngine
 	
 	UnityEngine::Transform UnityEngine::MonoBehaviour::GetTransform()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineMonoBehaviourPropertyGetTransform(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6072,6 +6407,7 @@ namespace System
 		: System::Runtime::InteropServices::_Exception(nullptr)
 		, System::Runtime::Serialization::ISerializable(nullptr)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::SystemExceptionConstructorSystemString(message.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6288,6 +6624,7 @@ namespace UnityEngine
 	
 	UnityEngine::PrimitiveType::operator System::Enum()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxPrimitiveType(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6306,6 +6643,7 @@ namespace UnityEngine
 	
 	UnityEngine::PrimitiveType::operator System::ValueType()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxPrimitiveType(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6324,6 +6662,7 @@ namespace UnityEngine
 	
 	UnityEngine::PrimitiveType::operator System::Object()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxPrimitiveType(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6342,6 +6681,7 @@ namespace UnityEngine
 	
 	UnityEngine::PrimitiveType::operator System::IFormattable()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxPrimitiveType(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6360,6 +6700,7 @@ namespace UnityEngine
 	
 	UnityEngine::PrimitiveType::operator System::IConvertible()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxPrimitiveType(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6378,6 +6719,7 @@ namespace UnityEngine
 	
 	UnityEngine::PrimitiveType::operator System::IComparable()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		int32_t handle = Plugin::BoxPrimitiveType(*this);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6406,6 +6748,7 @@ namespace System
 {
 	System::Object::operator UnityEngine::PrimitiveType()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		UnityEngine::PrimitiveType returnVal(Plugin::UnboxPrimitiveType(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6588,6 +6931,7 @@ namespace UnityEngine
 	UnityEngine::Sprite::Sprite()
 		: UnityEngine::Object(nullptr)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineSpriteConstructor();
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6605,6 +6949,7 @@ namespace UnityEngine
 	
 	UnityEngine::Bounds UnityEngine::Sprite::GetBounds()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineSpritePropertyGetBounds(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6705,6 +7050,7 @@ namespace UnityEngine
 	
 	UnityEngine::Sprite UnityEngine::SpriteRenderer::GetSprite()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineSpriteRendererPropertyGetSprite(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6718,6 +7064,7 @@ namespace UnityEngine
 	
 	void UnityEngine::SpriteRenderer::SetSprite(UnityEngine::Sprite& value)
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		Plugin::UnityEngineSpriteRendererPropertySetSprite(Handle, value.Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6730,6 +7077,7 @@ namespace UnityEngine
 	
 	UnityEngine::Bounds UnityEngine::SpriteRenderer::GetBounds()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineSpriteRendererPropertyGetBounds(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6824,6 +7172,7 @@ namespace UnityEngine
 	
 	System::Single UnityEngine::Time::GetDeltaTime()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		auto returnValue = Plugin::UnityEngineTimePropertyGetDeltaTime();
 		if (Plugin::unhandledCsharpException)
 		{
@@ -6838,19 +7187,11 @@ namespace UnityEngine
 
 namespace MyGame
 {
-	AbstractBaseGameScript::AbstractBaseGameScript(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
+	NativeBatch::NativeBatch(decltype(nullptr))
 	{
 	}
 	
-	AbstractBaseGameScript::AbstractBaseGameScript(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
+	NativeBatch::NativeBatch(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -6859,18 +7200,18 @@ namespace MyGame
 		}
 	}
 	
-	AbstractBaseGameScript::AbstractBaseGameScript(const AbstractBaseGameScript& other)
-		: AbstractBaseGameScript(Plugin::InternalUse::Only, other.Handle)
+	NativeBatch::NativeBatch(const NativeBatch& other)
+		: NativeBatch(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	AbstractBaseGameScript::AbstractBaseGameScript(AbstractBaseGameScript&& other)
-		: AbstractBaseGameScript(Plugin::InternalUse::Only, other.Handle)
+	NativeBatch::NativeBatch(NativeBatch&& other)
+		: NativeBatch(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	AbstractBaseGameScript::~AbstractBaseGameScript()
+	NativeBatch::~NativeBatch()
 	{
 		if (Handle)
 		{
@@ -6879,7 +7220,7 @@ namespace MyGame
 		}
 	}
 	
-	AbstractBaseGameScript& AbstractBaseGameScript::operator=(const AbstractBaseGameScript& other)
+	NativeBatch& NativeBatch::operator=(const NativeBatch& other)
 	{
 		if (this->Handle)
 		{
@@ -6893,7 +7234,7 @@ namespace MyGame
 		return *this;
 	}
 	
-	AbstractBaseGameScript& AbstractBaseGameScript::operator=(decltype(nullptr))
+	NativeBatch& NativeBatch::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -6903,7 +7244,7 @@ namespace MyGame
 		return *this;
 	}
 	
-	AbstractBaseGameScript& AbstractBaseGameScript::operator=(AbstractBaseGameScript&& other)
+	NativeBatch& NativeBatch::operator=(NativeBatch&& other)
 	{
 		if (Handle)
 		{
@@ -6914,30 +7255,20 @@ namespace MyGame
 		return *this;
 	}
 	
-	bool AbstractBaseGameScript::operator==(const AbstractBaseGameScript& other) const
+	bool NativeBatch::operator==(const NativeBatch& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool AbstractBaseGameScript::operator!=(const AbstractBaseGameScript& other) const
+	bool NativeBatch::operator!=(const NativeBatch& other) const
 	{
 		return Handle != other.Handle;
 	}
-}
-
-namespace MyGame
-{
-	MyGame::BaseGameScript::BaseGameScript()
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseGameScript(nullptr)
+	
+	void MyGame::NativeBatch::RegisterArchetype(System::Int32 archetype, System::String& name, System::Int32 flags)
 	{
-		CppHandle = Plugin::StoreBaseGameScript(this);
-		System::Int32* handle = (System::Int32*)&Handle;
-		int32_t cppHandle = CppHandle;
-		Plugin::BaseGameScriptConstructor(cppHandle, &handle->Value);
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32(archetype, name.Handle, flags);
 		if (Plugin::unhandledCsharpException)
 		{
 			System::Exception* ex = Plugin::unhandledCsharpException;
@@ -6945,15 +7276,26 @@ namespace MyGame
 			ex->ThrowReferenceToThis();
 			delete ex;
 		}
-		if (Handle)
-		{
-			Plugin::ReferenceManagedClass(Handle);
-		}
-		else
+	}
+	
+	System::Int32 MyGame::NativeBatch::RegisterSprites(void* handles, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32(handles, count);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::RemoveBaseGameScript(CppHandle);
-			CppHandle = 0;
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
 		}
+		return returnValue;
+	}
+	
+	void MyGame::NativeBatch::SetSprites(void* commands, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32(commands, count);
 		if (Plugin::unhandledCsharpException)
 		{
 			System::Exception* ex = Plugin::unhandledCsharpException;
@@ -6963,85 +7305,540 @@ namespace MyGame
 		}
 	}
 	
-	BaseGameScript::BaseGameScript(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseGameScript(nullptr)
+	System::Int32 MyGame::NativeBatch::LoadSpriteSequence(System::String& format, System::Int32 first, System::Int32 count)
 	{
-		CppHandle = Plugin::StoreBaseGameScript(this);
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32(format.Handle, first, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
 	}
 	
-	MyGame::BaseGameScript::BaseGameScript(const MyGame::BaseGameScript& other)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseGameScript(nullptr)
+	System::Int32 MyGame::NativeBatch::LoadSprites(System::String& manifest)
 	{
-		Handle = other.Handle;
-		CppHandle = Plugin::StoreBaseGameScript(this);
-		if (Handle)
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadSpritesSystemString(manifest.Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(Handle);
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
 		}
+		return returnValue;
 	}
 	
-	MyGame::BaseGameScript::BaseGameScript(MyGame::BaseGameScript&& other)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseGameScript(nullptr)
+	System::Int32 MyGame::NativeBatch::LoadClips(System::String& manifest, void* handles)
 	{
-		Handle = other.Handle;
-		CppHandle = other.CppHandle;
-		other.Handle = 0;
-		other.CppHandle = 0;
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtr(manifest.Handle, handles);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
 	}
 	
-	MyGame::BaseGameScript::BaseGameScript(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseGameScript(nullptr)
+	System::Int32 MyGame::NativeBatch::LoadSpriteSequenceAsync(System::String& format, System::Int32 first, System::Int32 count)
 	{
-		Handle = handle;
-		CppHandle = Plugin::StoreBaseGameScript(this);
-		if (Handle)
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32(format.Handle, first, count);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(Handle);
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
 		}
+		return returnValue;
 	}
 	
-	MyGame::BaseGameScript::~BaseGameScript()
+	System::Int32 MyGame::NativeBatch::LoadSpritesAsync(System::String& manifest)
 	{
-		Plugin::RemoveWholeBaseGameScript(this);
-		Plugin::RemoveBaseGameScript(CppHandle);
-		CppHandle = 0;
-		if (Handle)
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadSpritesAsyncSystemString(manifest.Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			int32_t handle = Handle;
-			Handle = 0;
-			if (Plugin::DereferenceManagedClassNoRelease(handle))
-			{
-				Plugin::ReleaseBaseGameScript(handle);
-				if (Plugin::unhandledCsharpException)
-				{
-					System::Exception* ex = Plugin::unhandledCsharpException;
-					Plugin::unhandledCsharpException = nullptr;
-					ex->ThrowReferenceToThis();
-					delete ex;
-				}
-			}
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
 		}
+		return returnValue;
 	}
 	
-	MyGame::BaseGameScript& MyGame::BaseGameScript::operator=(const MyGame::BaseGameScript& other)
+	System::Int32 MyGame::NativeBatch::LoadClipsAsync(System::String& manifest, void* handles)
 	{
-		if (this->Handle)
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtr(manifest.Handle, handles);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	System::Single MyGame::NativeBatch::PollLoads()
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodPollLoads();
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	void MyGame::NativeBatch::SetPositions(void* commands, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32(commands, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void MyGame::NativeBatch::GetSpriteBounds(void* bounds, System::Int32 first, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32(bounds, first, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void MyGame::NativeBatch::Spawn(void* descriptors, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32(descriptors, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void MyGame::NativeBatch::Destroy(void* slots, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32(slots, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void MyGame::NativeBatch::PlayOneShots(void* commands, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32(commands, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void MyGame::NativeBatch::DestroyMany(void* handles, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32(handles, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	System::Int32 MyGame::NativeBatch::GetSpriteUVs(void* uvs, System::Int32 first, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32(uvs, first, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	void MyGame::NativeBatch::DrawSprites(void* layers, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32(layers, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	System::Int32 MyGame::NativeBatch::LoadAtlasAsync(System::String& path, System::String& format, System::Int32 first, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32(path.Handle, format.Handle, first, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	void MyGame::NativeBatch::GetViewRect(void* rect)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodGetViewRectSystemIntPtr(rect);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	void MyGame::NativeBatch::GetClipLengths(void* handles, void* lengths, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32(handles, lengths, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	System::Int32 MyGame::NativeBatch::GetSoundDirectory(void* buffer, System::Int32 size)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32(buffer, size);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	System::Int32 MyGame::NativeBatch::GetOutputSampleRate()
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodGetOutputSampleRate();
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	void MyGame::NativeBatch::SetAudioStream(void* ring, System::Int32 frames)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32(ring, frames);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	System::Int32 MyGame::NativeBatch::GetPackPath(void* buffer, System::Int32 size)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32(buffer, size);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	System::Int32 MyGame::NativeBatch::AddPackSprites(void* pixels, System::Int32 width, System::Int32 height, void* frames, System::Int32 count)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32(pixels, width, height, frames, count);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+	
+	System::Int32 MyGame::NativeBatch::CreatePackClip(System::Int32 frames, System::Int32 sampleRate)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32(frames, sampleRate);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+}
+
+namespace MyGame
+{
+	AbstractBaseGameScript::AbstractBaseGameScript(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+	{
+	}
+	
+	AbstractBaseGameScript::AbstractBaseGameScript(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	AbstractBaseGameScript::AbstractBaseGameScript(const AbstractBaseGameScript& other)
+		: AbstractBaseGameScript(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	AbstractBaseGameScript::AbstractBaseGameScript(AbstractBaseGameScript&& other)
+		: AbstractBaseGameScript(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	AbstractBaseGameScript::~AbstractBaseGameScript()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	AbstractBaseGameScript& AbstractBaseGameScript::operator=(const AbstractBaseGameScript& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	AbstractBaseGameScript& AbstractBaseGameScript::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	AbstractBaseGameScript& AbstractBaseGameScript::operator=(AbstractBaseGameScript&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool AbstractBaseGameScript::operator==(const AbstractBaseGameScript& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool AbstractBaseGameScript::operator!=(const AbstractBaseGameScript& other) const
+	{
+		return Handle != other.Handle;
+	}
+}
+
+namespace MyGame
+{
+	MyGame::BaseGameScript::BaseGameScript()
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseGameScript(nullptr)
+	{
+		CppHandle = Plugin::StoreBaseGameScript(this);
+		System::Int32* handle = (System::Int32*)&Handle;
+		int32_t cppHandle = CppHandle;
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::BaseGameScriptConstructor(cppHandle, &handle->Value);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		if (Handle)
+		{
+			Plugin::ReferenceManagedClass(Handle);
+		}
+		else
+		{
+			Plugin::RemoveBaseGameScript(CppHandle);
+			CppHandle = 0;
+		}
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	BaseGameScript::BaseGameScript(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseGameScript(nullptr)
+	{
+		CppHandle = Plugin::StoreBaseGameScript(this);
+	}
+	
+	MyGame::BaseGameScript::BaseGameScript(const MyGame::BaseGameScript& other)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseGameScript(nullptr)
+	{
+		Handle = other.Handle;
+		CppHandle = Plugin::StoreBaseGameScript(this);
+		if (Handle)
+		{
+			Plugin::ReferenceManagedClass(Handle);
+		}
+	}
+	
+	MyGame::BaseGameScript::BaseGameScript(MyGame::BaseGameScript&& other)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseGameScript(nullptr)
+	{
+		Handle = other.Handle;
+		CppHandle = other.CppHandle;
+		other.Handle = 0;
+		other.CppHandle = 0;
+	}
+	
+	MyGame::BaseGameScript::BaseGameScript(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseGameScript(nullptr)
+	{
+		Handle = handle;
+		CppHandle = Plugin::StoreBaseGameScript(this);
+		if (Handle)
+		{
+			Plugin::ReferenceManagedClass(Handle);
+		}
+	}
+	
+	MyGame::BaseGameScript::~BaseGameScript()
+	{
+		Plugin::RemoveWholeBaseGameScript(this);
+		Plugin::RemoveBaseGameScript(CppHandle);
+		CppHandle = 0;
+		if (Handle)
+		{
+			int32_t handle = Handle;
+			Handle = 0;
+			if (Plugin::DereferenceManagedClassNoRelease(handle))
+			{
+				Plugin::ReleaseBaseGameScript(handle);
+				if (Plugin::unhandledCsharpException)
+				{
+					System::Exception* ex = Plugin::unhandledCsharpException;
+					Plugin::unhandledCsharpException = nullptr;
+					ex->ThrowReferenceToThis();
+					delete ex;
+				}
+			}
+		}
+	}
+	
+	MyGame::BaseGameScript& MyGame::BaseGameScript::operator=(const MyGame::BaseGameScript& other)
+	{
+		if (this->Handle)
 		{
 			Plugin::DereferenceManagedClass(this->Handle);
 		}
@@ -7150,6 +7947,7 @@ namespace System
 {
 	System::Object::operator System::Boolean()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Boolean returnVal(Plugin::UnboxBoolean(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7166,6 +7964,7 @@ namespace System
 {
 	System::Object::operator System::SByte()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::SByte returnVal(Plugin::UnboxSByte(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7182,6 +7981,7 @@ namespace System
 {
 	System::Object::operator System::Byte()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Byte returnVal(Plugin::UnboxByte(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7198,6 +7998,7 @@ namespace System
 {
 	System::Object::operator System::Int16()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Int16 returnVal(Plugin::UnboxInt16(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7214,6 +8015,7 @@ namespace System
 {
 	System::Object::operator System::UInt16()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::UInt16 returnVal(Plugin::UnboxUInt16(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7230,6 +8032,7 @@ namespace System
 {
 	System::Object::operator System::Int32()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Int32 returnVal(Plugin::UnboxInt32(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7246,6 +8049,7 @@ namespace System
 {
 	System::Object::operator System::UInt32()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::UInt32 returnVal(Plugin::UnboxUInt32(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7262,6 +8066,7 @@ namespace System
 {
 	System::Object::operator System::Int64()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Int64 returnVal(Plugin::UnboxInt64(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7278,6 +8083,7 @@ namespace System
 {
 	System::Object::operator System::UInt64()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::UInt64 returnVal(Plugin::UnboxUInt64(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7294,6 +8100,7 @@ namespace System
 {
 	System::Object::operator System::Char()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Char returnVal(Plugin::UnboxChar(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7310,6 +8117,7 @@ namespace System
 {
 	System::Object::operator System::Single()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Single returnVal(Plugin::UnboxSingle(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7326,6 +8134,7 @@ namespace System
 {
 	System::Object::operator System::Double()
 	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
 		System::Double returnVal(Plugin::UnboxDouble(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
@@ -7338,6 +8147,250 @@ namespace System
 	}
 }
 
+namespace Plugin
+{
+	ArrayElementProxy1_2<System::Single>::ArrayElementProxy1_2(Plugin::InternalUse, int32_t handle, int32_t index0)
+	{
+		Handle = handle;
+		Index0 = index0;
+	}
+	
+	Plugin::ArrayElementProxy2_2<System::Single> Plugin::ArrayElementProxy1_2<System::Single>::operator[](int32_t index)
+	{
+		return Plugin::ArrayElementProxy2_2<System::Single>(Plugin::InternalUse::Only, Handle, Index0, index);
+	}
+}
+
+namespace Plugin
+{
+	ArrayElementProxy2_2<System::Single>::ArrayElementProxy2_2(Plugin::InternalUse, int32_t handle, int32_t index0, int32_t index1)
+	{
+		Handle = handle;
+		Index0 = index0;
+		Index1 = index1;
+	}
+	
+	void ArrayElementProxy2_2<System::Single>::operator=(System::Single item)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		Plugin::SystemSingleArray2SetItem2(Handle, Index0, Index1, item);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+	}
+	
+	ArrayElementProxy2_2<System::Single>::operator System::Single()
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::SystemSingleArray2GetItem2(Handle, Index0, Index1);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		return returnValue;
+	}
+}
+
+namespace System
+{
+	Array2<System::Single>::Array2(decltype(nullptr))
+		: System::ICloneable(nullptr)
+		, System::Collections::IEnumerable(nullptr)
+		, System::Collections::ICollection(nullptr)
+		, System::Collections::IList(nullptr)
+		, System::Array(nullptr)
+	{
+		this->InternalLength = 0;
+		this->InternalLengths[0] = 0;
+		this->InternalLengths[1] = 0;
+	}
+	
+	Array2<System::Single>::Array2(Plugin::InternalUse, int32_t handle)
+		: System::ICloneable(nullptr)
+		, System::Collections::IEnumerable(nullptr)
+		, System::Collections::ICollection(nullptr)
+		, System::Collections::IList(nullptr)
+		, System::Array(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+		this->InternalLength = 0;
+		this->InternalLengths[0] = 0;
+		this->InternalLengths[1] = 0;
+	}
+	
+	Array2<System::Single>::Array2(const Array2<System::Single>& other)
+		: Array2(Plugin::InternalUse::Only, other.Handle)
+	{
+		InternalLength = other.InternalLength;
+		InternalLengths[0] = other.InternalLengths[0];
+		InternalLengths[1] = other.InternalLengths[1];
+	}
+	
+	Array2<System::Single>::Array2(Array2<System::Single>&& other)
+		: Array2(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+		InternalLength = other.InternalLength;
+		InternalLengths[0] = other.InternalLengths[0];
+		InternalLengths[1] = other.InternalLengths[1];
+		other.InternalLength = 0;
+		other.InternalLengths[0] = 0;
+		other.InternalLengths[1] = 0;
+	}
+	
+	Array2<System::Single>::~Array2()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	Array2<System::Single>& Array2<System::Single>::operator=(const Array2<System::Single>& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		InternalLength = other.InternalLength;
+		InternalLengths[0] = other.InternalLengths[0];
+		InternalLengths[1] = other.InternalLengths[1];
+		return *this;
+	}
+	
+	Array2<System::Single>& Array2<System::Single>::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	Array2<System::Single>& Array2<System::Single>::operator=(Array2<System::Single>&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		InternalLength = other.InternalLength;
+		InternalLengths[0] = other.InternalLengths[0];
+		InternalLengths[1] = other.InternalLengths[1];
+		other.Handle = 0;
+		other.InternalLength = 0;
+		other.InternalLengths[0] = 0;
+		other.InternalLengths[1] = 0;
+		return *this;
+	}
+	
+	bool Array2<System::Single>::operator==(const Array2<System::Single>& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool Array2<System::Single>::operator!=(const Array2<System::Single>& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	System::Array2<System::Single>::Array2(System::Int32 length0, System::Int32 length1)
+		: System::ICloneable(nullptr)
+		, System::Collections::IEnumerable(nullptr)
+		, System::Collections::ICollection(nullptr)
+		, System::Collections::IList(nullptr)
+		, System::Array(nullptr)
+	{
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::SystemSystemSingleArray2Constructor2(length0, length1);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		Handle = returnValue;
+		if (returnValue)
+		{
+			Plugin::ReferenceManagedClass(returnValue);
+			InternalLength = length0 * length1;
+			InternalLengths[0] = length0;
+			InternalLengths[1] = length1;
+		}
+	}
+	
+	System::Int32 System::Array2<System::Single>::GetLength()
+	{
+		int32_t returnVal = InternalLength;
+		if (returnVal == 0)
+		{
+			returnVal = Array::GetLength();
+			InternalLength = returnVal;
+		};
+		return returnVal;
+	}
+	
+	System::Int32 System::Array2<System::Single>::GetLength(System::Int32 dimension)
+	{
+		assert(dimension >= 0 && dimension < 2);
+		int32_t length = InternalLengths[dimension];
+		if (length)
+		{
+			return length;
+		}
+		NATIVE_SCRIPT_ASSERT_MAIN_THREAD();
+		auto returnValue = Plugin::SystemSystemSingleArray2GetLength2(Handle, dimension);
+		if (Plugin::unhandledCsharpException)
+		{
+			System::Exception* ex = Plugin::unhandledCsharpException;
+			Plugin::unhandledCsharpException = nullptr;
+			ex->ThrowReferenceToThis();
+			delete ex;
+		}
+		InternalLengths[dimension] = returnValue;
+		return returnValue;
+	}
+	
+	System::Int32 System::Array2<System::Single>::GetRank()
+	{
+		return 2;
+	}
+	
+	Plugin::ArrayElementProxy1_2<System::Single> System::Array2<System::Single>::operator[](int32_t index)
+	{
+		return Plugin::ArrayElementProxy1_2<System::Single>(Plugin::InternalUse::Only, Handle, index);
+	}
+	
+	void System::Array2<System::Single>::CopyTo(System::Single* destination, int32_t start, int32_t count)
+	{
+		Array::CopyToRaw(destination, start * (int32_t)sizeof(System::Single), count * (int32_t)sizeof(System::Single));
+	}
+	
+	void System::Array2<System::Single>::CopyFrom(const System::Single* source, int32_t start, int32_t count)
+	{
+		Array::CopyFromRaw(source, start * (int32_t)sizeof(System::Single), count * (int32_t)sizeof(System::Single));
+	}
+}
+
 namespace System
 {
 	struct NullReferenceExceptionThrower : System::NullReferenceException
@@ -7393,6 +8446,11 @@ DLLEXPORT void Init(
 {
 	uint8_t* curMemory = memory;
 	
+#ifdef NATIVE_SCRIPT_THREAD_SAFE
+	// C# calls Init from the main thread
+	Plugin::isMainThread = true;
+#endif
+	
 	// Read fixed parameters
 	Plugin::ReleaseObject = *(void (**)(int32_t handle))curMemory;
 	curMemory += sizeof(Plugin::ReleaseObject);
@@ -7404,6 +8462,10 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::ArrayGetLength);
 	Plugin::EnumerableGetEnumerator = *(int32_t (**)(int32_t))curMemory;
 	curMemory += sizeof(Plugin::EnumerableGetEnumerator);
+	Plugin::ArrayPin = *(void* (**)(int32_t, int32_t, int32_t, void**))curMemory;
+	curMemory += sizeof(Plugin::ArrayPin);
+	Plugin::ArrayUnpin = *(void (**)(void*))curMemory;
+	curMemory += sizeof(Plugin::ArrayUnpin);
 	
 	// Read generated parameters
 	int32_t maxManagedObjects = *(int32_t*)curMemory;
@@ -7499,6 +8561,10 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveType);
 	Plugin::UnityEngineDebugMethodLogSystemObject = *(void (**)(int32_t messageHandle))curMemory;
 	curMemory += sizeof(Plugin::UnityEngineDebugMethodLogSystemObject);
+	Plugin::UnityEngineDebugMethodLogWarningSystemObject = *(void (**)(int32_t messageHandle))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineDebugMethodLogWarningSystemObject);
+	Plugin::UnityEngineDebugMethodLogErrorSystemObject = *(void (**)(int32_t messageHandle))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineDebugMethodLogErrorSystemObject);
 	Plugin::UnityEngineAudioClipConstructor = *(int32_t (**)())curMemory;
 	curMemory += sizeof(Plugin::UnityEngineAudioClipConstructor);
 	Plugin::UnityEngineAudioSourcePropertyGetLoop = *(int32_t (**)(int32_t thisHandle))curMemory;
@@ -7549,6 +8615,60 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::UnityEngineSpriteRendererPropertyGetBounds);
 	Plugin::UnityEngineTimePropertyGetDeltaTime = *(System::Single (**)())curMemory;
 	curMemory += sizeof(Plugin::UnityEngineTimePropertyGetDeltaTime);
+	Plugin::MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32 = *(void (**)(int32_t archetype, int32_t nameHandle, int32_t flags))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32);
+	Plugin::MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32 = *(System::Int32 (**)(void* handles, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32 = *(void (**)(void* commands, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32 = *(System::Int32 (**)(int32_t formatHandle, int32_t first, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32);
+	Plugin::MyGameNativeBatchMethodLoadSpritesSystemString = *(System::Int32 (**)(int32_t manifestHandle))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadSpritesSystemString);
+	Plugin::MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtr = *(System::Int32 (**)(int32_t manifestHandle, void* handles))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtr);
+	Plugin::MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32 = *(System::Int32 (**)(int32_t formatHandle, int32_t first, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32);
+	Plugin::MyGameNativeBatchMethodLoadSpritesAsyncSystemString = *(System::Int32 (**)(int32_t manifestHandle))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadSpritesAsyncSystemString);
+	Plugin::MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtr = *(System::Int32 (**)(int32_t manifestHandle, void* handles))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtr);
+	Plugin::MyGameNativeBatchMethodPollLoads = *(System::Single (**)())curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodPollLoads);
+	Plugin::MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32 = *(void (**)(void* commands, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32 = *(void (**)(void* bounds, int32_t first, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32);
+	Plugin::MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32 = *(void (**)(void* descriptors, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32 = *(void (**)(void* slots, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32 = *(void (**)(void* commands, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32 = *(void (**)(void* handles, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32 = *(System::Int32 (**)(void* uvs, int32_t first, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32);
+	Plugin::MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32 = *(void (**)(void* layers, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32 = *(System::Int32 (**)(int32_t pathHandle, int32_t formatHandle, int32_t first, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32);
+	Plugin::MyGameNativeBatchMethodGetViewRectSystemIntPtr = *(void (**)(void* rect))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetViewRectSystemIntPtr);
+	Plugin::MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32 = *(void (**)(void* handles, void* lengths, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32 = *(System::Int32 (**)(void* buffer, int32_t size))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodGetOutputSampleRate = *(System::Int32 (**)())curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetOutputSampleRate);
+	Plugin::MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32 = *(void (**)(void* ring, int32_t frames))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32 = *(System::Int32 (**)(void* buffer, int32_t size))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32 = *(System::Int32 (**)(void* pixels, int32_t width, int32_t height, void* frames, int32_t count))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32);
+	Plugin::MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32 = *(System::Int32 (**)(int32_t frames, int32_t sampleRate))curMemory;
+	curMemory += sizeof(Plugin::MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32);
 	Plugin::ReleaseBaseGameScript = *(void (**)(int32_t handle))curMemory;
 	curMemory += sizeof(Plugin::ReleaseBaseGameScript);
 	Plugin::BaseGameScriptConstructor = *(void (**)(int32_t cppHandle, int32_t* handle))curMemory;
@@ -7601,6 +8721,14 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::BoxDouble);
 	Plugin::UnboxDouble = *(System::Double (**)(int32_t valHandle))curMemory;
 	curMemory += sizeof(Plugin::UnboxDouble);
+	Plugin::SystemSystemSingleArray2Constructor2 = *(int32_t (**)(int32_t length0, int32_t length1))curMemory;
+	curMemory += sizeof(Plugin::SystemSystemSingleArray2Constructor2);
+	Plugin::SystemSystemSingleArray2GetLength2 = *(int32_t (**)(int32_t thisHandle, int32_t dimension))curMemory;
+	curMemory += sizeof(Plugin::SystemSystemSingleArray2GetLength2);
+	Plugin::SystemSingleArray2GetItem2 = *(System::Single (**)(int32_t thisHandle, int32_t index0, int32_t index1))curMemory;
+	curMemory += sizeof(Plugin::SystemSingleArray2GetItem2);
+	Plugin::SystemSingleArray2SetItem2 = *(int32_t (**)(int32_t thisHandle, int32_t index0, int32_t index1, float item))curMemory;
+	curMemory += sizeof(Plugin::SystemSingleArray2SetItem2);
 	/*END INIT BODY PARAMETER READS*/
 	
 	// Init managed object ref counting
@@ -452,6 +452,11 @@ namespace UnityEngine
 	struct Time;
 }
 
+namespace MyGame
+{
+	struct NativeBatch;
+}
+
 namespace MyGame
 {
 	struct AbstractBaseGameScript;
@@ -598,6 +603,21 @@ namespace System
 {
 	template<> struct IComparable_1<System::Decimal>;
 }
+
+namespace Plugin
+{
+	template<> struct ArrayElementProxy1_2<System::Single>;
+}
+
+namespace Plugin
+{
+	template<> struct ArrayElementProxy2_2<System::Single>;
+}
+
+namespace System
+{
+	template<> struct Array2<System::Single>;
+}
 /*END TEMPLATE SPECIALIZATION DECLARATIONS*/
 
 ////////////////////////////////////////////////////////////////
@@ -695,6 +715,10 @@ namespace System
 		Array(decltype(nullptr));
 		int32_t GetLength();
 		int32_t GetRank();
+		
+		// Copy a byte range of a blittable array with one pinned memcpy
+		void CopyToRaw(void* destination, int32_t byteOffset, int32_t byteCount);
+		void CopyFromRaw(const void* source, int32_t byteOffset, int32_t byteCount);
 	};
 }
 
@@ -707,6 +731,35 @@ namespace Plugin
 	extern System::String NullString;
 }
 
+////////////////////////////////////////////////////////////////
+// Threading
+//
+// C# may only be called from the main thread, the one that calls
+// Init. Define NATIVE_SCRIPT_THREAD_SAFE so other threads can
+// still hold wrapper objects. They may then copy, assign, compare
+// and destroy them and read their handles. Reference counts
+// become atomic. A release that happens off the main thread is
+// queued until the main thread calls FlushDeferredReleases.
+// Everything else calls into C# and asserts that it's on the
+// main thread.
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Check if the calling thread is the one that called Init
+	bool IsMainThread();
+	
+	// Release objects whose last reference went away on another
+	// thread. Call from the main thread, e.g. once per frame.
+	void FlushDeferredReleases();
+}
+
+#if defined(NATIVE_SCRIPT_THREAD_SAFE) && !defined(NDEBUG)
+	#define NATIVE_SCRIPT_ASSERT_MAIN_THREAD() assert(Plugin::IsMainThread())
+#else
+	#define NATIVE_SCRIPT_ASSERT_MAIN_THREAD()
+#endif
+
 /*BEGIN TYPE DEFINITIONS*/
 namespace System
 {
@@ -763,11 +816,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Boolean> : virtual System::Object
 	{
-		IEquatable_1<System::Boolean>(decltype(nullptr));
-		IEquatable_1<System::Boolean>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Boolean>(const IEquatable_1<System::Boolean>& other);
-		IEquatable_1<System::Boolean>(IEquatable_1<System::Boolean>&& other);
-		virtual ~IEquatable_1<System::Boolean>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Boolean>& other);
+		IEquatable_1(IEquatable_1<System::Boolean>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Boolean>& operator=(const IEquatable_1<System::Boolean>& other);
 		IEquatable_1<System::Boolean>& operator=(decltype(nullptr));
 		IEquatable_1<System::Boolean>& operator=(IEquatable_1<System::Boolean>&& other);
@@ -780,11 +833,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Char> : virtual System::Object
 	{
-		IEquatable_1<System::Char>(decltype(nullptr));
-		IEquatable_1<System::Char>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Char>(const IEquatable_1<System::Char>& other);
-		IEquatable_1<System::Char>(IEquatable_1<System::Char>&& other);
-		virtual ~IEquatable_1<System::Char>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Char>& other);
+		IEquatable_1(IEquatable_1<System::Char>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Char>& operator=(const IEquatable_1<System::Char>& other);
 		IEquatable_1<System::Char>& operator=(decltype(nullptr));
 		IEquatable_1<System::Char>& operator=(IEquatable_1<System::Char>&& other);
@@ -797,11 +850,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::SByte> : virtual System::Object
 	{
-		IEquatable_1<System::SByte>(decltype(nullptr));
-		IEquatable_1<System::SByte>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::SByte>(const IEquatable_1<System::SByte>& other);
-		IEquatable_1<System::SByte>(IEquatable_1<System::SByte>&& other);
-		virtual ~IEquatable_1<System::SByte>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::SByte>& other);
+		IEquatable_1(IEquatable_1<System::SByte>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::SByte>& operator=(const IEquatable_1<System::SByte>& other);
 		IEquatable_1<System::SByte>& operator=(decltype(nullptr));
 		IEquatable_1<System::SByte>& operator=(IEquatable_1<System::SByte>&& other);
@@ -814,11 +867,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Byte> : virtual System::Object
 	{
-		IEquatable_1<System::Byte>(decltype(nullptr));
-		IEquatable_1<System::Byte>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Byte>(const IEquatable_1<System::Byte>& other);
-		IEquatable_1<System::Byte>(IEquatable_1<System::Byte>&& other);
-		virtual ~IEquatable_1<System::Byte>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Byte>& other);
+		IEquatable_1(IEquatable_1<System::Byte>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Byte>& operator=(const IEquatable_1<System::Byte>& other);
 		IEquatable_1<System::Byte>& operator=(decltype(nullptr));
 		IEquatable_1<System::Byte>& operator=(IEquatable_1<System::Byte>&& other);
@@ -831,11 +884,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Int16> : virtual System::Object
 	{
-		IEquatable_1<System::Int16>(decltype(nullptr));
-		IEquatable_1<System::Int16>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Int16>(const IEquatable_1<System::Int16>& other);
-		IEquatable_1<System::Int16>(IEquatable_1<System::Int16>&& other);
-		virtual ~IEquatable_1<System::Int16>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Int16>& other);
+		IEquatable_1(IEquatable_1<System::Int16>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Int16>& operator=(const IEquatable_1<System::Int16>& other);
 		IEquatable_1<System::Int16>& operator=(decltype(nullptr));
 		IEquatable_1<System::Int16>& operator=(IEquatable_1<System::Int16>&& other);
@@ -848,11 +901,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::UInt16> : virtual System::Object
 	{
-		IEquatable_1<System::UInt16>(decltype(nullptr));
-		IEquatable_1<System::UInt16>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::UInt16>(const IEquatable_1<System::UInt16>& other);
-		IEquatable_1<System::UInt16>(IEquatable_1<System::UInt16>&& other);
-		virtual ~IEquatable_1<System::UInt16>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::UInt16>& other);
+		IEquatable_1(IEquatable_1<System::UInt16>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::UInt16>& operator=(const IEquatable_1<System::UInt16>& other);
 		IEquatable_1<System::UInt16>& operator=(decltype(nullptr));
 		IEquatable_1<System::UInt16>& operator=(IEquatable_1<System::UInt16>&& other);
@@ -865,11 +918,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Int32> : virtual System::Object
 	{
-		IEquatable_1<System::Int32>(decltype(nullptr));
-		IEquatable_1<System::Int32>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Int32>(const IEquatable_1<System::Int32>& other);
-		IEquatable_1<System::Int32>(IEquatable_1<System::Int32>&& other);
-		virtual ~IEquatable_1<System::Int32>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Int32>& other);
+		IEquatable_1(IEquatable_1<System::Int32>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Int32>& operator=(const IEquatable_1<System::Int32>& other);
 		IEquatable_1<System::Int32>& operator=(decltype(nullptr));
 		IEquatable_1<System::Int32>& operator=(IEquatable_1<System::Int32>&& other);
@@ -882,11 +935,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::UInt32> : virtual System::Object
 	{
-		IEquatable_1<System::UInt32>(decltype(nullptr));
-		IEquatable_1<System::UInt32>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::UInt32>(const IEquatable_1<System::UInt32>& other);
-		IEquatable_1<System::UInt32>(IEquatable_1<System::UInt32>&& other);
-		virtual ~IEquatable_1<System::UInt32>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::UInt32>& other);
+		IEquatable_1(IEquatable_1<System::UInt32>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::UInt32>& operator=(const IEquatable_1<System::UInt32>& other);
 		IEquatable_1<System::UInt32>& operator=(decltype(nullptr));
 		IEquatable_1<System::UInt32>& operator=(IEquatable_1<System::UInt32>&& other);
@@ -899,11 +952,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Int64> : virtual System::Object
 	{
-		IEquatable_1<System::Int64>(decltype(nullptr));
-		IEquatable_1<System::Int64>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Int64>(const IEquatable_1<System::Int64>& other);
-		IEquatable_1<System::Int64>(IEquatable_1<System::Int64>&& other);
-		virtual ~IEquatable_1<System::Int64>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Int64>& other);
+		IEquatable_1(IEquatable_1<System::Int64>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Int64>& operator=(const IEquatable_1<System::Int64>& other);
 		IEquatable_1<System::Int64>& operator=(decltype(nullptr));
 		IEquatable_1<System::Int64>& operator=(IEquatable_1<System::Int64>&& other);
@@ -916,11 +969,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::UInt64> : virtual System::Object
 	{
-		IEquatable_1<System::UInt64>(decltype(nullptr));
-		IEquatable_1<System::UInt64>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::UInt64>(const IEquatable_1<System::UInt64>& other);
-		IEquatable_1<System::UInt64>(IEquatable_1<System::UInt64>&& other);
-		virtual ~IEquatable_1<System::UInt64>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::UInt64>& other);
+		IEquatable_1(IEquatable_1<System::UInt64>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::UInt64>& operator=(const IEquatable_1<System::UInt64>& other);
 		IEquatable_1<System::UInt64>& operator=(decltype(nullptr));
 		IEquatable_1<System::UInt64>& operator=(IEquatable_1<System::UInt64>&& other);
@@ -933,11 +986,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Single> : virtual System::Object
 	{
-		IEquatable_1<System::Single>(decltype(nullptr));
-		IEquatable_1<System::Single>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Single>(const IEquatable_1<System::Single>& other);
-		IEquatable_1<System::Single>(IEquatable_1<System::Single>&& other);
-		virtual ~IEquatable_1<System::Single>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Single>& other);
+		IEquatable_1(IEquatable_1<System::Single>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Single>& operator=(const IEquatable_1<System::Single>& other);
 		IEquatable_1<System::Single>& operator=(decltype(nullptr));
 		IEquatable_1<System::Single>& operator=(IEquatable_1<System::Single>&& other);
@@ -950,11 +1003,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Double> : virtual System::Object
 	{
-		IEquatable_1<System::Double>(decltype(nullptr));
-		IEquatable_1<System::Double>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Double>(const IEquatable_1<System::Double>& other);
-		IEquatable_1<System::Double>(IEquatable_1<System::Double>&& other);
-		virtual ~IEquatable_1<System::Double>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Double>& other);
+		IEquatable_1(IEquatable_1<System::Double>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Double>& operator=(const IEquatable_1<System::Double>& other);
 		IEquatable_1<System::Double>& operator=(decltype(nullptr));
 		IEquatable_1<System::Double>& operator=(IEquatable_1<System::Double>&& other);
@@ -967,11 +1020,11 @@ namespace System
 {
 	template<> struct IEquatable_1<System::Decimal> : virtual System::Object
 	{
-		IEquatable_1<System::Decimal>(decltype(nullptr));
-		IEquatable_1<System::Decimal>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<System::Decimal>(const IEquatable_1<System::Decimal>& other);
-		IEquatable_1<System::Decimal>(IEquatable_1<System::Decimal>&& other);
-		virtual ~IEquatable_1<System::Decimal>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<System::Decimal>& other);
+		IEquatable_1(IEquatable_1<System::Decimal>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<System::Decimal>& operator=(const IEquatable_1<System::Decimal>& other);
 		IEquatable_1<System::Decimal>& operator=(decltype(nullptr));
 		IEquatable_1<System::Decimal>& operator=(IEquatable_1<System::Decimal>&& other);
@@ -984,11 +1037,11 @@ namespace System
 {
 	template<> struct IEquatable_1<UnityEngine::Vector3> : virtual System::Object
 	{
-		IEquatable_1<UnityEngine::Vector3>(decltype(nullptr));
-		IEquatable_1<UnityEngine::Vector3>(Plugin::InternalUse, int32_t handle);
-		IEquatable_1<UnityEngine::Vector3>(const IEquatable_1<UnityEngine::Vector3>& other);
-		IEquatable_1<UnityEngine::Vector3>(IEquatable_1<UnityEngine::Vector3>&& other);
-		virtual ~IEquatable_1<UnityEngine::Vector3>();
+		IEquatable_1(decltype(nullptr));
+		IEquatable_1(Plugin::InternalUse, int32_t handle);
+		IEquatable_1(const IEquatable_1<UnityEngine::Vector3>& other);
+		IEquatable_1(IEquatable_1<UnityEngine::Vector3>&& other);
+		virtual ~IEquatable_1();
 		IEquatable_1<UnityEngine::Vector3>& operator=(const IEquatable_1<UnityEngine::Vector3>& other);
 		IEquatable_1<UnityEngine::Vector3>& operator=(decltype(nullptr));
 		IEquatable_1<UnityEngine::Vector3>& operator=(IEquatable_1<UnityEngine::Vector3>&& other);
@@ -1001,11 +1054,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Boolean> : virtual System::Object
 	{
-		IComparable_1<System::Boolean>(decltype(nullptr));
-		IComparable_1<System::Boolean>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Boolean>(const IComparable_1<System::Boolean>& other);
-		IComparable_1<System::Boolean>(IComparable_1<System::Boolean>&& other);
-		virtual ~IComparable_1<System::Boolean>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Boolean>& other);
+		IComparable_1(IComparable_1<System::Boolean>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Boolean>& operator=(const IComparable_1<System::Boolean>& other);
 		IComparable_1<System::Boolean>& operator=(decltype(nullptr));
 		IComparable_1<System::Boolean>& operator=(IComparable_1<System::Boolean>&& other);
@@ -1018,11 +1071,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Char> : virtual System::Object
 	{
-		IComparable_1<System::Char>(decltype(nullptr));
-		IComparable_1<System::Char>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Char>(const IComparable_1<System::Char>& other);
-		IComparable_1<System::Char>(IComparable_1<System::Char>&& other);
-		virtual ~IComparable_1<System::Char>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Char>& other);
+		IComparable_1(IComparable_1<System::Char>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Char>& operator=(const IComparable_1<System::Char>& other);
 		IComparable_1<System::Char>& operator=(decltype(nullptr));
 		IComparable_1<System::Char>& operator=(IComparable_1<System::Char>&& other);
@@ -1035,11 +1088,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::SByte> : virtual System::Object
 	{
-		IComparable_1<System::SByte>(decltype(nullptr));
-		IComparable_1<System::SByte>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::SByte>(const IComparable_1<System::SByte>& other);
-		IComparable_1<System::SByte>(IComparable_1<System::SByte>&& other);
-		virtual ~IComparable_1<System::SByte>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::SByte>& other);
+		IComparable_1(IComparable_1<System::SByte>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::SByte>& operator=(const IComparable_1<System::SByte>& other);
 		IComparable_1<System::SByte>& operator=(decltype(nullptr));
 		IComparable_1<System::SByte>& operator=(IComparable_1<System::SByte>&& other);
@@ -1052,11 +1105,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Byte> : virtual System::Object
 	{
-		IComparable_1<System::Byte>(decltype(nullptr));
-		IComparable_1<System::Byte>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Byte>(const IComparable_1<System::Byte>& other);
-		IComparable_1<System::Byte>(IComparable_1<System::Byte>&& other);
-		virtual ~IComparable_1<System::Byte>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Byte>& other);
+		IComparable_1(IComparable_1<System::Byte>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Byte>& operator=(const IComparable_1<System::Byte>& other);
 		IComparable_1<System::Byte>& operator=(decltype(nullptr));
 		IComparable_1<System::Byte>& operator=(IComparable_1<System::Byte>&& other);
@@ -1069,11 +1122,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Int16> : virtual System::Object
 	{
-		IComparable_1<System::Int16>(decltype(nullptr));
-		IComparable_1<System::Int16>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Int16>(const IComparable_1<System::Int16>& other);
-		IComparable_1<System::Int16>(IComparable_1<System::Int16>&& other);
-		virtual ~IComparable_1<System::Int16>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Int16>& other);
+		IComparable_1(IComparable_1<System::Int16>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Int16>& operator=(const IComparable_1<System::Int16>& other);
 		IComparable_1<System::Int16>& operator=(decltype(nullptr));
 		IComparable_1<System::Int16>& operator=(IComparable_1<System::Int16>&& other);
@@ -1086,11 +1139,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::UInt16> : virtual System::Object
 	{
-		IComparable_1<System::UInt16>(decltype(nullptr));
-		IComparable_1<System::UInt16>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::UInt16>(const IComparable_1<System::UInt16>& other);
-		IComparable_1<System::UInt16>(IComparable_1<System::UInt16>&& other);
-		virtual ~IComparable_1<System::UInt16>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::UInt16>& other);
+		IComparable_1(IComparable_1<System::UInt16>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::UInt16>& operator=(const IComparable_1<System::UInt16>& other);
 		IComparable_1<System::UInt16>& operator=(decltype(nullptr));
 		IComparable_1<System::UInt16>& operator=(IComparable_1<System::UInt16>&& other);
@@ -1103,11 +1156,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Int32> : virtual System::Object
 	{
-		IComparable_1<System::Int32>(decltype(nullptr));
-		IComparable_1<System::Int32>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Int32>(const IComparable_1<System::Int32>& other);
-		IComparable_1<System::Int32>(IComparable_1<System::Int32>&& other);
-		virtual ~IComparable_1<System::Int32>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Int32>& other);
+		IComparable_1(IComparable_1<System::Int32>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Int32>& operator=(const IComparable_1<System::Int32>& other);
 		IComparable_1<System::Int32>& operator=(decltype(nullptr));
 		IComparable_1<System::Int32>& operator=(IComparable_1<System::Int32>&& other);
@@ -1120,11 +1173,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::UInt32> : virtual System::Object
 	{
-		IComparable_1<System::UInt32>(decltype(nullptr));
-		IComparable_1<System::UInt32>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::UInt32>(const IComparable_1<System::UInt32>& other);
-		IComparable_1<System::UInt32>(IComparable_1<System::UInt32>&& other);
-		virtual ~IComparable_1<System::UInt32>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::UInt32>& other);
+		IComparable_1(IComparable_1<System::UInt32>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::UInt32>& operator=(const IComparable_1<System::UInt32>& other);
 		IComparable_1<System::UInt32>& operator=(decltype(nullptr));
 		IComparable_1<System::UInt32>& operator=(IComparable_1<System::UInt32>&& other);
@@ -1137,11 +1190,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Int64> : virtual System::Object
 	{
-		IComparable_1<System::Int64>(decltype(nullptr));
-		IComparable_1<System::Int64>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Int64>(const IComparable_1<System::Int64>& other);
-		IComparable_1<System::Int64>(IComparable_1<System::Int64>&& other);
-		virtual ~IComparable_1<System::Int64>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Int64>& other);
+		IComparable_1(IComparable_1<System::Int64>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Int64>& operator=(const IComparable_1<System::Int64>& other);
 		IComparable_1<System::Int64>& operator=(decltype(nullptr));
 		IComparable_1<System::Int64>& operator=(IComparable_1<System::Int64>&& other);
@@ -1154,11 +1207,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::UInt64> : virtual System::Object
 	{
-		IComparable_1<System::UInt64>(decltype(nullptr));
-		IComparable_1<System::UInt64>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::UInt64>(const IComparable_1<System::UInt64>& other);
-		IComparable_1<System::UInt64>(IComparable_1<System::UInt64>&& other);
-		virtual ~IComparable_1<System::UInt64>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::UInt64>& other);
+		IComparable_1(IComparable_1<System::UInt64>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::UInt64>& operator=(const IComparable_1<System::UInt64>& other);
 		IComparable_1<System::UInt64>& operator=(decltype(nullptr));
 		IComparable_1<System::UInt64>& operator=(IComparable_1<System::UInt64>&& other);
@@ -1171,11 +1224,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Single> : virtual System::Object
 	{
-		IComparable_1<System::Single>(decltype(nullptr));
-		IComparable_1<System::Single>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Single>(const IComparable_1<System::Single>& other);
-		IComparable_1<System::Single>(IComparable_1<System::Single>&& other);
-		virtual ~IComparable_1<System::Single>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Single>& other);
+		IComparable_1(IComparable_1<System::Single>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Single>& operator=(const IComparable_1<System::Single>& other);
 		IComparable_1<System::Single>& operator=(decltype(nullptr));
 		IComparable_1<System::Single>& operator=(IComparable_1<System::Single>&& other);
@@ -1188,11 +1241,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Double> : virtual System::Object
 	{
-		IComparable_1<System::Double>(decltype(nullptr));
-		IComparable_1<System::Double>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Double>(const IComparable_1<System::Double>& other);
-		IComparable_1<System::Double>(IComparable_1<System::Double>&& other);
-		virtual ~IComparable_1<System::Double>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Double>& other);
+		IComparable_1(IComparable_1<System::Double>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Double>& operator=(const IComparable_1<System::Double>& other);
 		IComparable_1<System::Double>& operator=(decltype(nullptr));
 		IComparable_1<System::Double>& operator=(IComparable_1<System::Double>&& other);
@@ -1205,11 +1258,11 @@ namespace System
 {
 	template<> struct IComparable_1<System::Decimal> : virtual System::Object
 	{
-		IComparable_1<System::Decimal>(decltype(nullptr));
-		IComparable_1<System::Decimal>(Plugin::InternalUse, int32_t handle);
-		IComparable_1<System::Decimal>(const IComparable_1<System::Decimal>& other);
-		IComparable_1<System::Decimal>(IComparable_1<System::Decimal>&& other);
-		virtual ~IComparable_1<System::Decimal>();
+		IComparable_1(decltype(nullptr));
+		IComparable_1(Plugin::InternalUse, int32_t handle);
+		IComparable_1(const IComparable_1<System::Decimal>& other);
+		IComparable_1(IComparable_1<System::Decimal>&& other);
+		virtual ~IComparable_1();
 		IComparable_1<System::Decimal>& operator=(const IComparable_1<System::Decimal>& other);
 		IComparable_1<System::Decimal>& operator=(decltype(nullptr));
 		IComparable_1<System::Decimal>& operator=(IComparable_1<System::Decimal>&& other);
@@ -1473,6 +1526,8 @@ namespace UnityEngine
 		bool operator==(const Debug& other) const;
 		bool operator!=(const Debug& other) const;
 		static void Log(System::Object& message);
+		static void LogWarning(System::Object& message);
+		static void LogError(System::Object& message);
 	};
 }
 
@@ -1726,6 +1781,50 @@ namespace UnityEngine
 	};
 }
 
+namespace MyGame
+{
+	struct NativeBatch : virtual System::Object
+	{
+		NativeBatch(decltype(nullptr));
+		NativeBatch(Plugin::InternalUse, int32_t handle);
+		NativeBatch(const NativeBatch& other);
+		NativeBatch(NativeBatch&& other);
+		virtual ~NativeBatch();
+		NativeBatch& operator=(const NativeBatch& other);
+		NativeBatch& operator=(decltype(nullptr));
+		NativeBatch& operator=(NativeBatch&& other);
+		bool operator==(const NativeBatch& other) const;
+		bool operator!=(const NativeBatch& other) const;
+		static void RegisterArchetype(System::Int32 archetype, System::String& name, System::Int32 flags);
+		static System::Int32 RegisterSprites(void* handles, System::Int32 count);
+		static void SetSprites(void* commands, System::Int32 count);
+		static System::Int32 LoadSpriteSequence(System::String& format, System::Int32 first, System::Int32 count);
+		static System::Int32 LoadSprites(System::String& manifest);
+		static System::Int32 LoadClips(System::String& manifest, void* handles);
+		static System::Int32 LoadSpriteSequenceAsync(System::String& format, System::Int32 first, System::Int32 count);
+		static System::Int32 LoadSpritesAsync(System::String& manifest);
+		static System::Int32 LoadClipsAsync(System::String& manifest, void* handles);
+		static System::Single PollLoads();
+		static void SetPositions(void* commands, System::Int32 count);
+		static void GetSpriteBounds(void* bounds, System::Int32 first, System::Int32 count);
+		static void Spawn(void* descriptors, System::Int32 count);
+		static void Destroy(void* slots, System::Int32 count);
+		static void PlayOneShots(void* commands, System::Int32 count);
+		static void DestroyMany(void* handles, System::Int32 count);
+		static System::Int32 GetSpriteUVs(void* uvs, System::Int32 first, System::Int32 count);
+		static void DrawSprites(void* layers, System::Int32 count);
+		static System::Int32 LoadAtlasAsync(System::String& path, System::String& format, System::Int32 first, System::Int32 count);
+		static void GetViewRect(void* rect);
+		static void GetClipLengths(void* handles, void* lengths, System::Int32 count);
+		static System::Int32 GetSoundDirectory(void* buffer, System::Int32 size);
+		static System::Int32 GetOutputSampleRate();
+		static void SetAudioStream(void* ring, System::Int32 frames);
+		static System::Int32 GetPackPath(void* buffer, System::Int32 size);
+		static System::Int32 AddPackSprites(void* pixels, System::Int32 width, System::Int32 height, void* frames, System::Int32 count);
+		static System::Int32 CreatePackClip(System::Int32 frames, System::Int32 sampleRate);
+	};
+}
+
 namespace MyGame
 {
 	struct AbstractBaseGameScript : virtual UnityEngine::MonoBehaviour
@@ -1762,6 +1861,56 @@ namespace MyGame
 		virtual void Update();
 	};
 }
+
+namespace Plugin
+{
+	template<> struct ArrayElementProxy1_2<System::Single>
+	{
+		int32_t Handle;
+		int32_t Index0;
+		ArrayElementProxy1_2(Plugin::InternalUse, int32_t handle, int32_t index0);
+		Plugin::ArrayElementProxy2_2<System::Single> operator[](int32_t index);
+	};
+}
+
+namespace Plugin
+{
+	template<> struct ArrayElementProxy2_2<System::Single>
+	{
+		int32_t Handle;
+		int32_t Index0;
+		int32_t Index1;
+		ArrayElementProxy2_2(Plugin::InternalUse, int32_t handle, int32_t index0, int32_t index1);
+		void operator=(System::Single item);
+		operator System::Single();
+	};
+}
+
+namespace System
+{
+	template<> struct Array2<System::Single> : virtual System::Array, virtual System::ICloneable, virtual System::Collections::IList
+	{
+		Array2(decltype(nullptr));
+		Array2(Plugin::InternalUse, int32_t handle);
+		Array2(const Array2<System::Single>& other);
+		Array2(Array2<System::Single>&& other);
+		virtual ~Array2();
+		Array2<System::Single>& operator=(const Array2<System::Single>& other);
+		Array2<System::Single>& operator=(decltype(nullptr));
+		Array2<System::Single>& operator=(Array2<System::Single>&& other);
+		bool operator==(const Array2<System::Single>& other) const;
+		bool operator!=(const Array2<System::Single>& other) const;
+		int32_t InternalLength;
+		int32_t InternalLengths[2];
+		Array2(System::Int32 length0, System::Int32 length1);
+		System::Int32 GetLength();
+		System::Int32 GetLength(System::Int32 dimension);
+		System::Int32 GetRank();
+		Plugin::ArrayElementProxy1_2<System::Single> operator[](int32_t index);
+		void CopyTo(System::Single* destination, int32_t start, int32_t count);
+		void CopyFrom(const System::Single* source, int32_t start, int32_t count);
+	};
+}
 /*END TYPE DEFINITIONS*/
 
 /*BEGIN MACROS*/
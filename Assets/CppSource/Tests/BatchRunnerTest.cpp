@@ -0,0 +1,82 @@
+//
+// a batch of headless worlds is deterministic. the same seeds give the
+// same results run after run, whatever the workers did. the fragment
+// stress scenario runs too, and fills the field
+//
+
+#include"Bindings.h"
+using namespace System;
+using namespace UnityEngine;
+
+#include "BatchRunner.h"
+#include "Check.h"
+#include "TestPack.h"
+
+static bool SameStats(const Game::Stats &a, const Game::Stats &b)
+{
+	return a.RocksDestroyed == b.RocksDestroyed
+		&& a.AliensDestroyed == b.AliensDestroyed
+		&& a.ShipHits == b.ShipHits
+		&& a.RocksSplit == b.RocksSplit
+		&& a.PeakRocks == b.PeakRocks;
+}
+
+int main()
+{
+	const char *packPath = "BatchRunnerTest.pack";
+	CHECK(WriteTestPack(packPath) == 0);
+
+	Game source(true);
+	CHECK(source.LoadHeadless(packPath) == 0);
+
+	const int numFrames = 60 * 60;
+	const float deltaTime = 1.0f / 60;
+	std::vector<uint32_t> seeds;
+	seeds.push_back(1);
+	seeds.push_back(2);
+
+	BatchRunner runner(2);
+	BatchRunner::InputScript sweep = BatchRunner::SweepScript(120);
+	std::vector<BatchRunner::Result> first;
+	std::vector<BatchRunner::Result> second;
+	runner.Run(source, seeds, numFrames, deltaTime, sweep, first);
+	runner.Run(source, seeds, numFrames, deltaTime, sweep, second);
+
+	CHECK(first.size() == seeds.size());
+	CHECK(second.size() == seeds.size());
+	int i;
+	for (i = 0; i < (int)first.size() && i < (int)second.size(); i++)
+	{
+		CHECK(first[i].Seed == seeds[i]);
+		CHECK(first[i].Frames == numFrames);
+		CHECK(first[i].SpriteErrors == 0);
+		CHECK(SameStats(first[i].Stats, second[i].Stats));
+
+		// a minute of sweeping fire has to have done something
+		CHECK(first[i].Stats.RocksDestroyed > 0);
+		CHECK(first[i].Stats.PeakRocks > 0);
+	}
+
+	// and the seed matters
+	if (first.size() == 2)
+	{
+		CHECK(!SameStats(first[0].Stats, first[1].Stats));
+	}
+
+	// twenty seconds of stress is plenty to split rocks into a crowd
+	runner.SetMode(Game::ModeFragmentStress);
+	seeds.resize(1);
+	runner.Run(source, seeds, 20 * 60, deltaTime, BatchRunner::StressScript(), first);
+	runner.Run(source, seeds, 20 * 60, deltaTime, BatchRunner::StressScript(), second);
+	CHECK(first.size() == 1 && second.size() == 1);
+	if (first.size() == 1 && second.size() == 1)
+	{
+		CHECK(first[0].SpriteErrors == 0);
+		CHECK(SameStats(first[0].Stats, second[0].Stats));
+		CHECK(first[0].Stats.RocksSplit > 0);
+		CHECK(first[0].Stats.PeakRocks > 50);
+	}
+
+	remove(packPath);
+	return NumFailures();
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+//
+// the one assertion the tests use. a failed check prints where it was and
+// is counted, and each test's main returns NumFailures() so ctest sees it
+//
+
+#include <stdio.h>
+
+static int sNumFailures = 0;
+
+#define CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			printf("%s(%d): CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+			sNumFailures++; \
+		} \
+	} while (0)
+
+inline int NumFailures()
+{
+	if (sNumFailures == 0)
+	{
+		printf("passed\n");
+	}
+	return sNumFailures;
+}
@@ -0,0 +1,171 @@
+//
+// a known .wav decodes to the samples it holds, the mixer sums and clamps
+// its voices, a headless recording reads back as what was mixed, and the
+// ring is kept far enough ahead for the frame that was just simulated
+//
+
+#include "Mixer.h"
+#include "Wav.h"
+#include "Check.h"
+#include <math.h>
+#include <string.h>
+
+// a 16 bit PCM .wav of the given samples, interleaved if stereo
+static std::vector<uint8_t> MakeWav(const int16_t *samples, int numSamples, int channels, int rate)
+{
+	uint32_t dataSize = numSamples * 2;
+	std::vector<uint8_t> file(44 + dataSize);
+	uint8_t *p = file.data();
+	const uint32_t header[] = {
+		36 + dataSize, 16, (uint32_t)(1 | channels << 16), (uint32_t)rate,
+		(uint32_t)(rate * channels * 2), (uint32_t)(channels * 2 | 16 << 16), dataSize,
+	};
+	const int offsets[] = { 4, 16, 20, 24, 28, 32, 40 };
+	int i;
+	for (i = 0; i < 7; i++)
+	{
+		p[offsets[i]] = (uint8_t)header[i];
+		p[offsets[i] + 1] = (uint8_t)(header[i] >> 8);
+		p[offsets[i] + 2] = (uint8_t)(header[i] >> 16);
+		p[offsets[i] + 3] = (uint8_t)(header[i] >> 24);
+	}
+	memcpy(p, "RIFF", 4);
+	memcpy(p + 8, "WAVEfmt ", 8);
+	memcpy(p + 36, "data", 4);
+	for (i = 0; i < numSamples; i++)
+	{
+		p[44 + i * 2] = (uint8_t)samples[i];
+		p[44 + i * 2 + 1] = (uint8_t)((uint16_t)samples[i] >> 8);
+	}
+	return file;
+}
+
+static bool WriteFile(const char *path, const std::vector<uint8_t> &bytes)
+{
+	FILE *file = fopen(path, "wb");
+	if (!file)
+		return false;
+	size_t written = fwrite(bytes.data(), 1, bytes.size(), file);
+	fclose(file);
+	return written == bytes.size();
+}
+
+static std::vector<uint8_t> ReadFile(const char *path)
+{
+	std::vector<uint8_t> bytes;
+	FILE *file = fopen(path, "rb");
+	if (!file)
+		return bytes;
+	uint8_t buffer[4096];
+	size_t count;
+	while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+	{
+		bytes.insert(bytes.end(), buffer, buffer + count);
+	}
+	fclose(file);
+	return bytes;
+}
+
+static int Buffered(Mixer &mixer)
+{
+	Mixer::Ring &ring = *mixer.GetRing();
+	return (int)(ring.WritePos.load() - ring.ReadPos.load());
+}
+
+int main()
+{
+	const int rate = 48000;
+
+	// mono 16 bit comes out as the same value on both sides
+	const int16_t mono[] = { 0, 16384, -16384, -32768 };
+	std::vector<float> samples;
+	CHECK(DecodeWav(MakeWav(mono, 4, 1, rate), rate, samples));
+	const float monoExpected[] = { 0, 0, 0.5f, 0.5f, -0.5f, -0.5f, -1, -1 };
+	CHECK(samples.size() == 8 && memcmp(samples.data(), monoExpected, sizeof(monoExpected)) == 0);
+
+	// stereo at half the rate is interpolated up to twice the frames
+	const int16_t stereo[] = { 0, 8192, 16384, -8192 };
+	CHECK(DecodeWav(MakeWav(stereo, 4, 2, rate / 2), rate, samples));
+	const float stereoExpected[] = { 0, 0.25f, 0.25f, 0, 0.5f, -0.25f, 0.5f, -0.25f };
+	CHECK(samples.size() == 8 && memcmp(samples.data(), stereoExpected, sizeof(stereoExpected)) == 0);
+
+	// not a .wav
+	std::vector<uint8_t> junk(64, 0);
+	CHECK(!DecodeWav(junk, rate, samples));
+
+	// a sound loaded from a file plays and sums, and clamps when it's too loud
+	const char *soundPath = "MixerTest.wav";
+	CHECK(WriteFile(soundPath, MakeWav(mono, 4, 1, rate)));
+	Mixer mixer(rate);
+	int sound = mixer.Load(soundPath);
+	CHECK(sound == 0);
+	remove(soundPath);
+
+	mixer.Play(sound, 0.5f, false);
+	mixer.Play(sound, 1.0f, false);
+	CHECK(mixer.GetNumVoices() == 2);
+	float out[6 * Mixer::NumChannels];
+	mixer.Mix(out, 6);
+	const float mixExpected[] = { 0, 0, 0.75f, 0.75f, -0.75f, -0.75f, -1, -1, 0, 0, 0, 0 };
+	CHECK(memcmp(out, mixExpected, sizeof(mixExpected)) == 0);
+	CHECK(mixer.GetNumVoices() == 0);
+
+	// a looping voice goes round until it's stopped
+	int32_t loop = mixer.Play(sound, 1.0f, true);
+	mixer.Mix(out, 6);
+	CHECK(out[8] == 0 && out[10] == 0.5f);
+	CHECK(mixer.GetNumVoices() == 1);
+	mixer.Stop(loop);
+	CHECK(mixer.GetNumVoices() == 0);
+
+	// record a tenth of a second of a tone, in frames that don't divide it
+	// evenly, and read it back
+	std::vector<float> tone(rate / 10 * Mixer::NumChannels);
+	int i;
+	for (i = 0; i < rate / 10; i++)
+	{
+		tone[i * 2] = 0.5f * sinf(6.2831853f * 440.0f * i / rate);
+		tone[i * 2 + 1] = -tone[i * 2];
+	}
+	sound = mixer.AddSound(tone.data(), rate / 10, rate, nullptr);
+
+	const char *recordPath = "MixerTest.recording.wav";
+	WavWriter recorder;
+	CHECK(recorder.Open(recordPath, rate));
+	mixer.Record(&recorder);
+	mixer.Play(sound, 1.0f, false);
+	const float deltaTime = 1.0f / 60;
+	int frame;
+	for (frame = 0; frame < 6; frame++)
+	{
+		mixer.Advance(deltaTime);
+	}
+	mixer.Record(nullptr);
+	recorder.Close();
+
+	CHECK(DecodeWav(ReadFile(recordPath), rate, samples));
+	remove(recordPath);
+	CHECK(samples.size() == tone.size());
+	float worst = 0;
+	for (i = 0; i < (int)samples.size() && i < (int)tone.size(); i++)
+	{
+		float error = fabsf(samples[i] - tone[i]);
+		worst = error > worst ? error : worst;
+	}
+	CHECK(worst <= 2.0f / 32768);
+
+	// the ring holds at least MinFillFrames, and two frames' worth after a
+	// long one, but never more than fits
+	Mixer streaming(rate);
+	streaming.Fill(deltaTime);
+	CHECK(Buffered(streaming) == Mixer::MinFillFrames);
+	streaming.Fill(0.1f);
+	CHECK(Buffered(streaming) == rate / 5);
+	streaming.GetRing()->ReadPos.store(streaming.GetRing()->WritePos.load() - 100);
+	streaming.Fill(deltaTime);
+	CHECK(Buffered(streaming) == Mixer::MinFillFrames);
+	streaming.Fill(1.0f);
+	CHECK(Buffered(streaming) == Mixer::RingFrames);
+
+	return NumFailures();
+}
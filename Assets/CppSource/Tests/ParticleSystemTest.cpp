@@ -0,0 +1,138 @@
+//
+// particles are deterministic and the vector loops in Update match the
+// plain scalar arithmetic bit for bit. a reference copy of one burst is
+// stepped here the scalar way and drawn next to the real thing
+//
+
+#include "ParticleSystem.h"
+#include "AssetPack.h"
+#include "Check.h"
+#include <cmath>
+#include <string.h>
+
+// the scalar path of ParticleSystem, one particle at a time
+struct Reference
+{
+	float X, Y;
+	float VX, VY;
+	float Age, Life;
+	float Frame, FrameRate;
+};
+
+// draws the same way as ParticleSystem::RandRange
+static float RandRange(std::minstd_rand &random, float min, float max)
+{
+	float t = (float)(random() - random.min()) / (float)(random.max() - random.min());
+	return min + (max - min) * t;
+}
+
+static bool SameQuads(const SpriteBatcher::Frame &a, const SpriteBatcher::Frame &b, int layer)
+{
+	const SpriteBatcher::LayerDesc &descA = a.GetLayers()[layer];
+	const SpriteBatcher::LayerDesc &descB = b.GetLayers()[layer];
+	if (descA.NumQuads != descB.NumQuads)
+		return false;
+	return memcmp((const void *)(intptr_t)descA.Vertices, (const void *)(intptr_t)descB.Vertices,
+		descA.NumQuads * 4 * sizeof(SpriteBatcher::Vertex)) == 0;
+}
+
+int main()
+{
+	SpriteTable sprites;
+	float frames[2 * AssetPack::FrameWords] = {
+		0, 0, 8, 8, 0.5f, 0.5f, 16,
+		8, 0, 8, 8, 0.5f, 0.5f, 16,
+	};
+	int sprite = sprites.AddSheet(frames, 2, 16, 8);
+
+	// five particles so the last group of four is partly padding
+	ParticleSystem::Emitter emitter = {};
+	emitter.Count = 5;
+	emitter.FirstSprite = sprite;
+	emitter.NumSprites = 2;
+	emitter.MinFrameRate = 4;
+	emitter.MaxFrameRate = 8;
+	emitter.Loop = false;
+	emitter.MinLife = 0.5f;
+	emitter.MaxLife = 1.0f;
+	emitter.MinSpeed = 1;
+	emitter.MaxSpeed = 3;
+	emitter.Drag = 0.5f;
+	emitter.Scale = 1;
+	emitter.Layer = SpriteBatcher::LayerExplosions;
+
+	const uint32_t seed = 7;
+	const float x = 0.25f, y = -0.5f, z = 1;
+	ParticleSystem first, second;
+	std::minstd_rand firstRandom(seed), secondRandom(seed), referenceRandom(seed);
+	first.Emit(first.AddEmitter(emitter), x, y, z, firstRandom);
+	second.Emit(second.AddEmitter(emitter), x, y, z, secondRandom);
+
+	std::vector<Reference> reference(emitter.Count);
+	int i;
+	for (i = 0; i < emitter.Count; i++)
+	{
+		Reference &r = reference[i];
+		float angle = RandRange(referenceRandom, 0, 6.2831853f);
+		float speed = RandRange(referenceRandom, emitter.MinSpeed, emitter.MaxSpeed);
+		r.X = x;
+		r.Y = y;
+		r.VX = std::cos(angle) * speed;
+		r.VY = std::sin(angle) * speed;
+		r.Age = 0;
+		r.Life = RandRange(referenceRandom, emitter.MinLife, emitter.MaxLife);
+		r.Frame = 0;
+		r.FrameRate = RandRange(referenceRandom, emitter.MinFrameRate, emitter.MaxFrameRate);
+	}
+	CHECK(first.GetCount() == emitter.Count);
+
+	MyGame::Rectangle<float> view(MyGame::Point<float>(-100, 100), MyGame::Point<float>(100, -100));
+	SpriteBatcher firstBatcher(sprites), secondBatcher(sprites), referenceBatcher(sprites);
+	const float deltaTime = 1.0f / 60;
+	bool someDied = false;
+	int step;
+	for (step = 0; step < 90; step++)
+	{
+		first.Update(deltaTime);
+		second.Update(deltaTime);
+
+		std::vector<Reference> live;
+		for (i = 0; i < (int)reference.size(); i++)
+		{
+			Reference r = reference[i];
+			r.X += r.VX * deltaTime;
+			r.Y += r.VY * deltaTime;
+			float keep = 1.0f - emitter.Drag * deltaTime;
+			keep = keep > 0 ? keep : 0;
+			r.VX *= keep;
+			r.VY *= keep;
+			r.Age += deltaTime;
+			r.Frame += r.FrameRate * deltaTime;
+			if (r.Age < r.Life)
+			{
+				live.push_back(r);
+			}
+		}
+		someDied = someDied || (!live.empty() && live.size() < reference.size());
+		reference.swap(live);
+		CHECK(first.GetCount() == (int)reference.size());
+		CHECK(second.GetCount() == first.GetCount());
+
+		first.Draw(firstBatcher, view);
+		second.Draw(secondBatcher, view);
+		for (i = 0; i < (int)reference.size(); i++)
+		{
+			int frame = (int)reference[i].Frame;
+			frame = frame < emitter.NumSprites ? frame : emitter.NumSprites - 1;
+			referenceBatcher.Add(emitter.Layer, sprite + frame, reference[i].X, reference[i].Y, z, emitter.Scale);
+		}
+		const SpriteBatcher::Frame &firstFrame = firstBatcher.Build();
+		CHECK(SameQuads(firstFrame, secondBatcher.Build(), emitter.Layer));
+		CHECK(SameQuads(firstFrame, referenceBatcher.Build(), emitter.Layer));
+	}
+
+	// they went at different times, and a second and a half outlives them all
+	CHECK(someDied);
+	CHECK(first.GetCount() == 0);
+	return NumFailures();
+}
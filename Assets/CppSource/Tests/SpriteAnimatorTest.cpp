@@ -0,0 +1,121 @@
+//
+// the animator reports every frame change and every clip that played out,
+// stale ids stop nothing, and 10,000 animations stay right frame after
+// frame. prints how long Update takes for them, the timing doesn't fail
+// the test
+//
+
+#include "SpriteAnimator.h"
+#include "Check.h"
+#include <chrono>
+#include <random>
+
+int main()
+{
+	// eight frames a second against steps of an eighth of a second, so the
+	// clock is exact
+	SpriteAnimator animator;
+	SpriteAnimator::Clip spin = { 10, 4, 8.0f, true };
+	SpriteAnimator::Clip burst = { 20, 3, 8.0f, false };
+	int spinClip = animator.AddClip(spin);
+	int burstClip = animator.AddClip(burst);
+
+	int a = 0, b = 0;
+	SpriteAnimator::Id spinId = animator.Play(spinClip, 3, &a);
+	SpriteAnimator::Id burstId = animator.Play(burstClip, 0, &b);
+	CHECK(spinId != 0 && burstId != 0 && spinId != burstId);
+	CHECK(animator.GetSprite(spinId) == 13);
+	CHECK(animator.GetSprite(burstId) == 20);
+
+	// the loop wraps to its first frame
+	animator.Update(0.125f);
+	CHECK(animator.GetChanges().size() == 2);
+	CHECK(animator.GetSprite(spinId) == 10);
+	CHECK(animator.GetSprite(burstId) == 21);
+	CHECK(animator.GetFinished().empty());
+
+	// a long step crosses two frames at once
+	animator.Update(0.25f);
+	CHECK(animator.GetSprite(spinId) == 12);
+	CHECK(animator.GetSprite(burstId) == -1);
+	CHECK(animator.GetFinished().size() == 1 && animator.GetFinished()[0].Owner == &b &&
+		animator.GetFinished()[0].Clip == burstClip);
+	CHECK(animator.GetNumPlaying() == 1);
+
+	// burst's handle is reused, and its old id doesn't touch the new one
+	SpriteAnimator::Id again = animator.Play(burstClip, 1, &b);
+	CHECK(again != burstId);
+	animator.Stop(burstId);
+	CHECK(animator.GetSprite(again) == 21);
+	animator.Stop(spinId);
+	animator.Stop(spinId);
+	CHECK(animator.GetNumPlaying() == 1);
+	CHECK(animator.GetSprite(again) == 21);
+	animator.Clear();
+	CHECK(animator.GetNumPlaying() == 0);
+	CHECK(animator.GetSprite(again) == -1);
+
+	// 10,000 animations, a quarter of them clips that play once and are
+	// started again as soon as they finish. every owner's sprite has to be
+	// exactly what the changes it was sent say
+	const int numAnimations = 10000;
+	std::minstd_rand random(1);
+	int i;
+	for (i = 0; i < 8; i++)
+	{
+		SpriteAnimator::Clip clip = { i * 100, 4 + i * 2, 8.0f + i * 2, i != 0 && i != 4 };
+		animator.AddClip(clip);
+	}
+	std::vector<int> owners(numAnimations);
+	std::vector<SpriteAnimator::Id> ids(numAnimations);
+	std::vector<int32_t> sprites(numAnimations);
+	for (i = 0; i < numAnimations; i++)
+	{
+		owners[i] = (int)(random() % 8);
+		ids[i] = animator.Play(owners[i], (int)(random() % 16), &owners[i]);
+		sprites[i] = animator.GetSprite(ids[i]);
+	}
+
+	const int numFrames = 600;
+	const float deltaTime = 1.0f / 60;
+	std::chrono::steady_clock::duration elapsed(0);
+	int numChanges = 0, numFinished = 0, numWrong = 0;
+	int frame;
+	for (frame = 0; frame < numFrames; frame++)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		animator.Update(deltaTime);
+		elapsed += std::chrono::steady_clock::now() - start;
+
+		const std::vector<SpriteAnimator::Change> &changes = animator.GetChanges();
+		for (i = 0; i < (int)changes.size(); i++)
+		{
+			sprites[(int *)changes[i].Owner - owners.data()] = changes[i].Sprite;
+		}
+		numChanges += (int)changes.size();
+
+		const std::vector<SpriteAnimator::Finished> &finished = animator.GetFinished();
+		for (i = 0; i < (int)finished.size(); i++)
+		{
+			int owner = (int)((int *)finished[i].Owner - owners.data());
+			CHECK(animator.GetSprite(ids[owner]) == -1);
+			ids[owner] = animator.Play(finished[i].Clip, 0, finished[i].Owner);
+			sprites[owner] = animator.GetSprite(ids[owner]);
+		}
+		numFinished += (int)finished.size();
+
+		for (i = 0; i < numAnimations; i++)
+		{
+			numWrong += animator.GetSprite(ids[i]) != sprites[i];
+		}
+	}
+	CHECK(numWrong == 0);
+	CHECK(numFinished > 0);
+	CHECK(animator.GetNumPlaying() == numAnimations);
+
+	double micros = std::chrono::duration<double, std::micro>(elapsed).count();
+	printf("%d animations, %.1f us an update, %d changes a frame\n", numAnimations, micros / numFrames,
+		numChanges / numFrames);
+
+	return NumFailures();
+}
@@ -0,0 +1,101 @@
+//
+// a built frame is what Unity's upload expects. quads grouped by texture
+// into ranges that cover the layer in order, four vertices each from the
+// bottom left going clockwise, and Validate agrees
+//
+
+#include "SpriteBatcher.h"
+#include "AssetPack.h"
+#include "Check.h"
+
+static void MakeFrame(float *frame, float x, float y, float width, float height, float pixelsPerUnit)
+{
+	frame[0] = x;
+	frame[1] = y;
+	frame[2] = width;
+	frame[3] = height;
+	frame[4] = 0.5f;
+	frame[5] = 0.5f;
+	frame[6] = pixelsPerUnit;
+}
+
+static bool SameVertex(const SpriteBatcher::Vertex &v, float x, float y, float z, float u, float uv)
+{
+	return v.X == x && v.Y == y && v.Z == z && v.U == u && v.V == uv;
+}
+
+int main()
+{
+	// texture 0 has two 8x8 frames side by side, half a unit each. texture 1
+	// has one 4x8 frame, half a unit wide and a unit high
+	SpriteTable sprites;
+	float sheetA[2 * AssetPack::FrameWords];
+	MakeFrame(sheetA, 0, 0, 8, 8, 16);
+	MakeFrame(sheetA + AssetPack::FrameWords, 8, 0, 8, 8, 16);
+	int a = sprites.AddSheet(sheetA, 2, 16, 8);
+	float sheetB[AssetPack::FrameWords];
+	MakeFrame(sheetB, 0, 0, 4, 8, 8);
+	int b = sprites.AddSheet(sheetB, 1, 4, 8);
+	CHECK(a == 0 && b == 2);
+	CHECK(sprites.GetNumTextures() == 2);
+
+	SpriteBatcher batcher(sprites);
+	batcher.Add(SpriteBatcher::LayerRocks, a, 1.0f, 2.0f, 0.5f);
+	batcher.Add(SpriteBatcher::LayerRocks, b, -1.0f, 0, 0);
+	batcher.Add(SpriteBatcher::LayerRocks, a + 1, 0, 0, 0, 2.0f);
+	batcher.Add(SpriteBatcher::LayerRocks, b, 3.0f, 0, 0);
+	batcher.Add(SpriteBatcher::LayerMissiles, b, 0, 0, 0);
+
+	const SpriteBatcher::Frame &frame = batcher.Build();
+	CHECK(&frame == &batcher.GetLastFrame());
+	CHECK(batcher.Validate(frame) == 0);
+
+	const SpriteBatcher::LayerDesc *layers = frame.GetLayers();
+	int layer;
+	for (layer = 0; layer < SpriteBatcher::NumLayers; layer++)
+	{
+		CHECK(layers[layer].Layer == layer);
+	}
+	CHECK(layers[SpriteBatcher::LayerStars].NumQuads == 0 && layers[SpriteBatcher::LayerStars].NumRanges == 0);
+	CHECK(layers[SpriteBatcher::LayerMissiles].NumQuads == 1 && layers[SpriteBatcher::LayerMissiles].NumRanges == 1);
+
+	// texture 0's quads first, then texture 1's, each in the order added
+	const SpriteBatcher::LayerDesc &rocks = layers[SpriteBatcher::LayerRocks];
+	CHECK(rocks.NumQuads == 4);
+	CHECK(rocks.NumRanges == 2);
+	const SpriteBatcher::Range *ranges = (const SpriteBatcher::Range *)(intptr_t)rocks.Ranges;
+	CHECK(ranges[0].Texture == 0 && ranges[0].FirstQuad == 0 && ranges[0].NumQuads == 2);
+	CHECK(ranges[1].Texture == 1 && ranges[1].FirstQuad == 2 && ranges[1].NumQuads == 2);
+
+	const SpriteBatcher::Vertex *v = (const SpriteBatcher::Vertex *)(intptr_t)rocks.Vertices;
+	CHECK(SameVertex(v[0], 0.75f, 1.75f, 0.5f, 0, 0));
+	CHECK(SameVertex(v[1], 0.75f, 2.25f, 0.5f, 0, 1));
+	CHECK(SameVertex(v[2], 1.25f, 2.25f, 0.5f, 0.5f, 1));
+	CHECK(SameVertex(v[3], 1.25f, 1.75f, 0.5f, 0.5f, 0));
+
+	// scaled twice over about its position, the right half of texture 0
+	CHECK(SameVertex(v[4], -0.5f, -0.5f, 0, 0.5f, 0));
+	CHECK(SameVertex(v[6], 0.5f, 0.5f, 0, 1, 1));
+
+	CHECK(SameVertex(v[8], -1.25f, -0.5f, 0, 0, 0));
+	CHECK(SameVertex(v[10], -0.75f, 0.5f, 0, 1, 1));
+	CHECK(SameVertex(v[12], 2.75f, -0.5f, 0, 0, 0));
+
+	// the next Build goes to the other buffer, the last one is left alone
+	batcher.Add(SpriteBatcher::LayerRocks, a, 0, 0, 0);
+	const SpriteBatcher::Frame &next = batcher.Build();
+	CHECK(&next != &frame);
+	CHECK(batcher.Validate(next) == 0);
+	CHECK(next.GetLayers()[SpriteBatcher::LayerRocks].NumQuads == 1);
+	CHECK(frame.GetLayers()[SpriteBatcher::LayerRocks].NumQuads == 4);
+	CHECK(batcher.Validate(frame) == 0);
+
+	// a frame off the edge of its texture is caught
+	float outside[AssetPack::FrameWords];
+	MakeFrame(outside, 8, 0, 8, 8, 16);
+	int bad = sprites.AddSheet(outside, 1, 8, 8);
+	batcher.Add(SpriteBatcher::LayerExplosions, bad, 0, 0, 0);
+	CHECK(batcher.Validate(batcher.Build()) == 1);
+
+	return NumFailures();
+}
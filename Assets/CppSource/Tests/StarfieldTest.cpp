@@ -0,0 +1,76 @@
+//
+// the starfield scrolls down and wraps without any star leaving the view,
+// and prints how long Update takes. the timing is only printed, it doesn't
+// fail the test
+//
+
+#include "Starfield.h"
+#include "AssetPack.h"
+#include "Check.h"
+#include <chrono>
+
+// the centre height of each star quad in the frame
+static std::vector<float> StarHeights(const SpriteBatcher::Frame &frame)
+{
+	const SpriteBatcher::LayerDesc &stars = frame.GetLayers()[SpriteBatcher::LayerStars];
+	const SpriteBatcher::Vertex *v = (const SpriteBatcher::Vertex *)(intptr_t)stars.Vertices;
+	std::vector<float> heights(stars.NumQuads);
+	int i;
+	for (i = 0; i < stars.NumQuads; i++)
+	{
+		heights[i] = (v[i * 4].Y + v[i * 4 + 1].Y) * 0.5f;
+	}
+	return heights;
+}
+
+int main()
+{
+	SpriteTable sprites;
+	float dot[AssetPack::FrameWords] = { 0, 0, 8, 8, 0.5f, 0.5f, 16 };
+	int sprite = sprites.AddSheet(dot, 1, 8, 8);
+
+	const float top = 1.905f, bottom = -1.905f;
+	MyGame::Rectangle<float> view(MyGame::Point<float>(-1.27f, top), MyGame::Point<float>(1.27f, bottom));
+	Starfield starfield;
+	starfield.Init(view, sprite, 1);
+	CHECK(starfield.GetCount() > 0);
+
+	SpriteBatcher batcher(sprites);
+	starfield.Draw(batcher);
+	std::vector<float> before = StarHeights(batcher.Build());
+	CHECK((int)before.size() == starfield.GetCount());
+
+	// a minute at 60 frames a second is long enough for the near stars to
+	// go round several times
+	const float deltaTime = 1.0f / 60;
+	const float tolerance = 0.0001f;
+	int numMoved = 0, numWrapped = 0;
+	int frame, i;
+	for (frame = 0; frame < 60 * 60; frame++)
+	{
+		starfield.Update(deltaTime);
+		starfield.Draw(batcher);
+		std::vector<float> after = StarHeights(batcher.Build());
+		CHECK(after.size() == before.size());
+		for (i = 0; i < (int)after.size() && i < (int)before.size(); i++)
+		{
+			CHECK(after[i] >= bottom - tolerance && after[i] <= top + tolerance);
+			numMoved += after[i] < before[i];
+			numWrapped += after[i] > before[i];
+		}
+		before.swap(after);
+	}
+	CHECK(numMoved > 0);
+	CHECK(numWrapped > 0);
+
+	const int numUpdates = 100000;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (i = 0; i < numUpdates; i++)
+	{
+		starfield.Update(deltaTime);
+	}
+	std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+	printf("%d stars, %.2f us an update\n", starfield.GetCount(), elapsed.count() / numUpdates);
+
+	return NumFailures();
+}
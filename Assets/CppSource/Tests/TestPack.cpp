@@ -0,0 +1,157 @@
+//
+// implementation for writing the tests' asset pack
+//
+
+#include "TestPack.h"
+#include "AssetPack.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct PackSection
+	{
+		std::string Name;
+		AssetPack::SectionType Type;
+		uint32_t Count;
+		uint32_t Width;
+		uint32_t Height;
+		std::vector<uint8_t> Data;
+	};
+
+	// frames of one size side by side on a blank texture, pivots centred,
+	// the way AssetPacker.cs lays out a sheet
+	struct SheetDesc
+	{
+		const char *Name;
+		int Count;
+		int FrameWidth, FrameHeight;	// pixels
+		float PixelsPerUnit;
+	};
+
+	void AddSheet(const SheetDesc &sheet, std::vector<PackSection> &sections)
+	{
+		PackSection texture;
+		texture.Name = sheet.Name;
+		texture.Type = AssetPack::TypeTexture;
+		texture.Count = 0;
+		texture.Width = sheet.Count * sheet.FrameWidth;
+		texture.Height = sheet.FrameHeight;
+		texture.Data.resize(texture.Width * texture.Height * 4);
+		sections.push_back(texture);
+
+		PackSection frames;
+		frames.Name = sheet.Name;
+		frames.Type = AssetPack::TypeFrames;
+		frames.Count = sheet.Count;
+		frames.Width = 0;
+		frames.Height = 0;
+		std::vector<float> words(sheet.Count * AssetPack::FrameWords);
+		int i;
+		for (i = 0; i < sheet.Count; i++)
+		{
+			float *frame = &words[i * AssetPack::FrameWords];
+			frame[0] = (float)(i * sheet.FrameWidth);
+			frame[1] = 0;
+			frame[2] = (float)sheet.FrameWidth;
+			frame[3] = (float)sheet.FrameHeight;
+			frame[4] = 0.5f;
+			frame[5] = 0.5f;
+			frame[6] = sheet.PixelsPerUnit;
+		}
+		frames.Data.resize(words.size() * sizeof(float));
+		memcpy(frames.Data.data(), words.data(), frames.Data.size());
+		sections.push_back(frames);
+	}
+
+	void AddTone(const char *name, float seconds, float frequency, std::vector<PackSection> &sections)
+	{
+		const int rate = 48000;
+		PackSection sound;
+		sound.Name = name;
+		sound.Type = AssetPack::TypeSound;
+		sound.Count = (uint32_t)(seconds * rate);
+		sound.Width = rate;
+		sound.Height = 0;
+
+		std::vector<float> samples(sound.Count * 2);
+		uint32_t i;
+		for (i = 0; i < sound.Count; i++)
+		{
+			samples[i * 2] = samples[i * 2 + 1] = 0.25f * sinf(6.2831853f * frequency * i / rate);
+		}
+		sound.Data.resize(samples.size() * sizeof(float));
+		memcpy(sound.Data.data(), samples.data(), sound.Data.size());
+		sections.push_back(sound);
+	}
+}
+
+//
+// returns 0 once it's written
+//
+int WriteTestPack(const char *path)
+{
+	// sheets in sprite table order. sizes in units are near enough the real
+	// sprites' for things to collide about as often
+	const SheetDesc sheets[] = {
+		{ "Background", 1, 60, 102, 10.0f },
+		{ "Sprites", 6, 8, 8, 16.0f },
+		{ "Rocks", 16, 8, 8, 16.0f },
+		{ "Explosions", 62, 8, 8, 12.5f },
+	};
+
+	std::vector<PackSection> sections;
+	int i;
+	for (i = 0; i < 4; i++)
+	{
+		AddSheet(sheets[i], sections);
+	}
+	AddTone("fire", 0.1f, 880.0f, sections);
+	AddTone("explosion_player", 0.5f, 110.0f, sections);
+	AddTone("bangLarge", 0.3f, 220.0f, sections);
+	AddTone("saucerBig", 0.2f, 440.0f, sections);
+
+	const uint32_t alignment = 4096;
+	int numSections = (int)sections.size();
+	std::vector<AssetPack::Section> index(numSections);
+	uint64_t end = sizeof(AssetPack::Header) + numSections * sizeof(AssetPack::Section);
+	for (i = 0; i < numSections; i++)
+	{
+		AssetPack::Section &section = index[i];
+		memset(&section, 0, sizeof(section));
+		memcpy(section.Name, sections[i].Name.c_str(), sections[i].Name.size());
+		section.Type = sections[i].Type;
+		section.Count = sections[i].Count;
+		section.Width = sections[i].Width;
+		section.Height = sections[i].Height;
+		section.Offset = (end + alignment - 1) / alignment * alignment;
+		section.Size = sections[i].Data.size();
+		end = section.Offset + section.Size;
+	}
+
+	AssetPack::Header header;
+	memset(&header, 0, sizeof(header));
+	header.Magic = AssetPack::Magic;
+	header.Version = AssetPack::Version;
+	header.NumSections = numSections;
+	header.Alignment = alignment;
+	header.FileSize = end;
+
+	std::vector<uint8_t> file((size_t)end);
+	memcpy(file.data(), &header, sizeof(header));
+	memcpy(file.data() + sizeof(header), index.data(), numSections * sizeof(AssetPack::Section));
+	for (i = 0; i < numSections; i++)
+	{
+		memcpy(file.data() + index[i].Offset, sections[i].Data.data(), sections[i].Data.size());
+	}
+
+	FILE *out = fopen(path, "wb");
+	if (!out)
+		return -1;
+	size_t written = fwrite(file.data(), 1, file.size(), out);
+	fclose(out);
+	return written == file.size() ? 0 : -1;
+}
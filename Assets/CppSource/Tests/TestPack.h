@@ -0,0 +1,9 @@
+#pragma once
+
+//
+// a small asset pack with every sheet and sound GameAssets looks for, so
+// tests can load a headless world without the editor building Game.pack.
+// textures are tiny and blank, sounds are short tones
+//
+
+int WriteTestPack(const char *path);
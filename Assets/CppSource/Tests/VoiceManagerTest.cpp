@@ -0,0 +1,72 @@
+//
+// the voice manager keeps to its caps and a higher priority sound always
+// gets a voice, stealing one from a lower priority sound if it has to
+//
+
+#include "VoiceManager.h"
+#include "CommandQueue.h"
+#include "Mixer.h"
+#include "Check.h"
+
+int main()
+{
+	// two short silent sounds on the mixer
+	Mixer mixer(48000);
+	std::vector<float> silence(48000 * Mixer::NumChannels);
+	int fireSound = mixer.AddSound(silence.data(), 48000, 48000, nullptr);
+	int deathSound = mixer.AddSound(silence.data(), 48000, 48000, nullptr);
+
+	CommandQueue commands(64);
+	commands.SetDiscard(true);
+
+	const int32_t fire = 1, death = 2;
+	const int32_t slot = 1;
+	VoiceManager voices(2);
+	voices.SetMixer(&mixer);
+	VoiceManager::ClipDesc fireDesc = { fire, 1, 3, 1.0f, fireSound };
+	VoiceManager::ClipDesc deathDesc = { death, 3, 1, 1.0f, deathSound };
+	voices.AddClip(fireDesc);
+	voices.AddClip(deathDesc);
+
+	// the same clip twice in a frame plays once
+	const float deltaTime = 1.0f / 60;
+	voices.Play(slot, fire);
+	voices.Play(slot, fire);
+	voices.Flush(deltaTime, commands);
+	CHECK(voices.GetNumPlaying() == 1);
+
+	// fire fills the game's two voices, below its own cap of three
+	voices.Play(slot, fire);
+	voices.Flush(deltaTime, commands);
+	CHECK(voices.GetNumPlaying() == 2);
+	CHECK(mixer.GetNumVoices() == 2);
+
+	// a third fire has nothing lower to steal from
+	voices.Play(slot, fire);
+	voices.Flush(deltaTime, commands);
+	CHECK(voices.GetNumPlaying() == 2);
+	CHECK(voices.GetNumDropped() == 1);
+	CHECK(voices.GetNumStolen() == 0);
+
+	// the death takes a fire's voice, and the fire stops on the mixer
+	voices.Play(slot, fire);
+	voices.Play(slot, death);
+	voices.Flush(deltaTime, commands);
+	CHECK(voices.GetNumStolen() == 1);
+	CHECK(voices.GetNumDropped() == 2);
+	CHECK(voices.GetNumPlaying() == 2);
+	CHECK(mixer.GetNumVoices() == 2);
+
+	// once the voices end there's room again
+	int frame;
+	for (frame = 0; frame < 90; frame++)
+	{
+		voices.Flush(deltaTime, commands);
+	}
+	CHECK(voices.GetNumPlaying() == 0);
+	voices.Play(slot, fire);
+	voices.Flush(deltaTime, commands);
+	CHECK(voices.GetNumPlaying() == 1);
+
+	return NumFailures();
+}
@@ -0,0 +1,293 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using UnityEditor;
+using UnityEngine;
+
+namespace MyGame.Editor
+{
+	/// Builds StreamingAssets/Game.pack, every sprite and sound the game
+	/// loads in one file that native code maps instead of going through
+	/// Resources. Sprites are packed into sheets as raw RGBA32 and sounds
+	/// are decoded to float stereo, so nothing is decoded at startup. Run
+	/// from the menu or by the asset_pack build target.
+	public static class AssetPacker
+	{
+		// one texture of frames, in sprite table order
+		struct SheetDesc
+		{
+			public string Name;
+			public string[] Paths;		// under Resources, without extension
+			public bool PowerOfTwo;
+
+			public SheetDesc(string name, string[] paths, bool powerOfTwo)
+			{
+				Name = name;
+				Paths = paths;
+				PowerOfTwo = powerOfTwo;
+			}
+		}
+
+		// Must match GameAssets::LoadPack in GameAssets.cpp
+		static readonly SheetDesc[] sheets = {
+			new SheetDesc("Background", new[] { "background600x1024" }, false),
+			new SheetDesc("Sprites", new[] {
+				"spaceship_high_left",
+				"spaceship_high_right",
+				"spaceship_high_center",
+				"missile",
+				"ufo",
+				"star" }, false),
+			new SheetDesc("Rocks", Sequence("tile{0:D3}", 0, 16), true),
+			new SheetDesc("Explosions", Sequence("explo64_b/explo64_b{0:D2}", 0, 62), true),
+		};
+		static readonly string[] sounds = { "fire", "explosion_player", "bangLarge", "saucerBig" };
+
+		// pack layout. Must match AssetPack.h
+		const int PackMagic = 0x4B415047;	// "GPAK"
+		const int PackVersion = 1;
+		const int HeaderBytes = 64;
+		const int SectionBytes = 64;
+		const int NameBytes = 32;
+		const int Alignment = 4096;			// every section starts on a page
+		const int TypeTexture = 1;
+		const int TypeFrames = 2;
+		const int TypeSound = 3;
+
+		// the usual output rate. the mixer plays sounds at this rate in
+		// place, and resamples a copy otherwise
+		const int SampleRate = 48000;
+
+		const string ResourcesDir = "Assets/Resources/";
+		const string PackPath = "Assets/StreamingAssets/Game.pack";
+
+		// one section and its contents
+		class Section
+		{
+			public string Name;
+			public int Type;
+			public int Count;
+			public int Width;
+			public int Height;
+			public byte[] Data;
+		}
+
+		[MenuItem("MyGame/Build Asset Pack")]
+		public static void PackAll()
+		{
+			var sections = new List<Section>();
+			foreach (SheetDesc sheet in sheets)
+			{
+				AddSheet(sheet, sections);
+			}
+			foreach (string sound in sounds)
+			{
+				AddSound(sound, sections);
+			}
+
+			Directory.CreateDirectory(Path.GetDirectoryName(PackPath));
+			long size = Write(sections);
+			AssetDatabase.Refresh();
+
+			Debug.Log("Packed " + sections.Count + " sections into " + PackPath + ", " + size + " bytes");
+		}
+
+		static string[] Sequence(string format, int first, int count)
+		{
+			var paths = new string[count];
+			for (int i = 0; i < count; ++i)
+			{
+				paths[i] = string.Format(format, first + i);
+			}
+			return paths;
+		}
+
+		static void AddSheet(SheetDesc sheet, List<Section> sections)
+		{
+			var paths = new string[sheet.Paths.Length];
+			for (int i = 0; i < paths.Length; ++i)
+			{
+				paths[i] = ResourcesDir + sheet.Paths[i] + ".png";
+			}
+			AtlasPacker.Atlas atlas = AtlasPacker.Build(paths, sheet.PowerOfTwo);
+
+			var pixels = new byte[atlas.Pixels.Length * 4];
+			for (int i = 0; i < atlas.Pixels.Length; ++i)
+			{
+				Color32 c = atlas.Pixels[i];
+				pixels[i * 4] = c.r;
+				pixels[i * 4 + 1] = c.g;
+				pixels[i * 4 + 2] = c.b;
+				pixels[i * 4 + 3] = c.a;
+			}
+			var texture = new Section();
+			texture.Name = sheet.Name;
+			texture.Type = TypeTexture;
+			texture.Width = atlas.Width;
+			texture.Height = atlas.Height;
+			texture.Data = pixels;
+			sections.Add(texture);
+
+			var frames = new Section();
+			frames.Name = sheet.Name;
+			frames.Type = TypeFrames;
+			frames.Count = paths.Length;
+			frames.Data = new byte[atlas.Frames.Length * 4];
+			Buffer.BlockCopy(atlas.Frames, 0, frames.Data, 0, frames.Data.Length);
+			sections.Add(frames);
+		}
+
+		static void AddSound(string name, List<Section> sections)
+		{
+			string path = ResourcesDir + "Sounds/" + name + ".wav";
+			float[] samples = DecodeWav(File.ReadAllBytes(path));
+			if (samples == null)
+			{
+				throw new Exception("Can't decode " + path + ", only 8 and 16 bit PCM is packed");
+			}
+
+			var sound = new Section();
+			sound.Name = name;
+			sound.Type = TypeSound;
+			sound.Count = samples.Length / 2;
+			sound.Width = SampleRate;
+			sound.Data = new byte[samples.Length * 4];
+			Buffer.BlockCopy(samples, 0, sound.Data, 0, sound.Data.Length);
+			sections.Add(sound);
+		}
+
+		/// Interleaved stereo at SampleRate, or null if it isn't PCM. Does
+		/// the same as DecodeWav in Wav.cpp, ahead of time
+		static float[] DecodeWav(byte[] file)
+		{
+			if (file.Length < 12
+				|| Encoding.ASCII.GetString(file, 0, 4) != "RIFF"
+				|| Encoding.ASCII.GetString(file, 8, 4) != "WAVE")
+			{
+				return null;
+			}
+
+			int channels = 0, rate = 0, bits = 0, data = -1, dataSize = 0;
+			int pos = 12;
+			while (pos + 8 <= file.Length)
+			{
+				string id = Encoding.ASCII.GetString(file, pos, 4);
+				int chunkSize = Math.Min(BitConverter.ToInt32(file, pos + 4), file.Length - pos - 8);
+				if (id == "fmt " && chunkSize >= 16)
+				{
+					if (BitConverter.ToInt16(file, pos + 8) != 1)
+					{
+						return null;
+					}
+					channels = BitConverter.ToInt16(file, pos + 10);
+					rate = BitConverter.ToInt32(file, pos + 12);
+					bits = BitConverter.ToInt16(file, pos + 22);
+				}
+				else if (id == "data")
+				{
+					data = pos + 8;
+					dataSize = chunkSize;
+				}
+				pos += 8 + chunkSize + (chunkSize & 1);
+			}
+			if (data < 0 || (channels != 1 && channels != 2) || (bits != 8 && bits != 16) || rate <= 0)
+			{
+				return null;
+			}
+
+			int bytesPerFrame = channels * bits / 8;
+			int numFrames = dataSize / bytesPerFrame;
+			var source = new float[numFrames * 2];
+			for (int i = 0; i < numFrames; ++i)
+			{
+				int frame = data + i * bytesPerFrame;
+				float left, right;
+				if (bits == 8)
+				{
+					left = (file[frame] - 128) / 128.0f;
+					right = channels == 2 ? (file[frame + 1] - 128) / 128.0f : left;
+				}
+				else
+				{
+					left = BitConverter.ToInt16(file, frame) / 32768.0f;
+					right = channels == 2 ? BitConverter.ToInt16(file, frame + 2) / 32768.0f : left;
+				}
+				source[i * 2] = left;
+				source[i * 2 + 1] = right;
+			}
+			if (rate == SampleRate || numFrames == 0)
+			{
+				return source;
+			}
+
+			double step = (double)rate / SampleRate;
+			int outFrames = (int)(numFrames / step);
+			var samples = new float[outFrames * 2];
+			for (int i = 0; i < outFrames; ++i)
+			{
+				double at = i * step;
+				int a = (int)at;
+				int b = Math.Min(a + 1, numFrames - 1);
+				float t = (float)(at - a);
+				samples[i * 2] = source[a * 2] + (source[b * 2] - source[a * 2]) * t;
+				samples[i * 2 + 1] = source[a * 2 + 1] + (source[b * 2 + 1] - source[a * 2 + 1]) * t;
+			}
+			return samples;
+		}
+
+		static long Align(long offset)
+		{
+			return (offset + Alignment - 1) / Alignment * Alignment;
+		}
+
+		/// The header, the section index, then each section on its own
+		/// page. Returns the file size
+		static long Write(List<Section> sections)
+		{
+			var offsets = new long[sections.Count];
+			long end = HeaderBytes + (long)sections.Count * SectionBytes;
+			for (int i = 0; i < sections.Count; ++i)
+			{
+				offsets[i] = Align(end);
+				end = offsets[i] + sections[i].Data.Length;
+			}
+
+			using (var pack = new BinaryWriter(File.Create(PackPath)))
+			{
+				pack.Write(PackMagic);
+				pack.Write(PackVersion);
+				pack.Write(sections.Count);
+				pack.Write(Alignment);
+				pack.Write(end);
+				pack.Write(new byte[HeaderBytes - 24]);
+
+				for (int i = 0; i < sections.Count; ++i)
+				{
+					Section section = sections[i];
+					var name = new byte[NameBytes];
+					byte[] ascii = Encoding.ASCII.GetBytes(section.Name);
+					if (ascii.Length >= NameBytes)
+					{
+						throw new Exception("Section name " + section.Name + " is too long");
+					}
+					Array.Copy(ascii, name, ascii.Length);
+					pack.Write(name);
+					pack.Write(section.Type);
+					pack.Write(section.Count);
+					pack.Write(section.Width);
+					pack.Write(section.Height);
+					pack.Write(offsets[i]);
+					pack.Write((long)section.Data.Length);
+				}
+
+				for (int i = 0; i < sections.Count; ++i)
+				{
+					pack.Write(new byte[offsets[i] - pack.BaseStream.Position]);
+					pack.Write(sections[i].Data);
+				}
+			}
+			return end;
+		}
+	}
+}
@@ -0,0 +1,180 @@
+using System;
+using System.IO;
+using UnityEditor;
+using UnityEngine;
+
+namespace MyGame.Editor
+{
+	/// Packs numbered animation frames from Resources into one texture per
+	/// sequence, plus a table of where each frame landed. Run from the
+	/// menu or by the atlases build target, which calls PackAll in batch
+	/// mode. The game loads the results with NativeBatch.LoadAtlasAsync.
+	public static class AtlasPacker
+	{
+		// one atlas and the frames that go in it
+		struct AtlasDesc
+		{
+			public string Name;		// under Resources/Atlases
+			public string Format;	// frame paths under Resources, like "tile{0:D3}"
+			public int First;
+			public int Count;
+
+			public AtlasDesc(string name, string format, int first, int count)
+			{
+				Name = name;
+				Format = format;
+				First = first;
+				Count = count;
+			}
+		}
+
+		// Must match the LoadAtlasAsync calls in GameAssets.cpp
+		static readonly AtlasDesc[] atlases = {
+			new AtlasDesc("Rocks", "tile{0:D3}", 0, 16),
+			new AtlasDesc("Explosions", "explo64_b/explo64_b{0:D2}", 0, 62),
+		};
+
+		// Must match NativeBatch.cs
+		const int AtlasMagic = 0x534C5441;	// "ATLS"
+		const int AtlasVersion = 1;
+
+		// empty pixels between frames, and how far each frame's edge is
+		// repeated into them so filtering never picks up a neighbour
+		const int Padding = 2;
+
+		const string ResourcesDir = "Assets/Resources/";
+		const string AtlasDir = "Assets/Resources/Atlases/";
+
+		[MenuItem("MyGame/Pack Atlases")]
+		public static void PackAll()
+		{
+			Directory.CreateDirectory(AtlasDir);
+			foreach (AtlasDesc atlas in atlases)
+			{
+				Pack(atlas);
+			}
+			AssetDatabase.Refresh();
+
+			foreach (AtlasDesc atlas in atlases)
+			{
+				var importer = (TextureImporter)AssetImporter.GetAtPath(AtlasDir + atlas.Name + ".png");
+				importer.textureType = TextureImporterType.Default;
+				importer.alphaIsTransparency = true;
+				importer.mipmapEnabled = false;
+				importer.npotScale = TextureImporterNPOTScale.None;
+				importer.wrapMode = TextureWrapMode.Clamp;
+				importer.textureCompression = TextureImporterCompression.Uncompressed;
+				importer.SaveAndReimport();
+			}
+		}
+
+		/// Frames packed into one texture, and where each one landed
+		public class Atlas
+		{
+			public int Width;
+			public int Height;
+			public Color32[] Pixels;	// bottom row first
+			public float[] Frames;		// FrameWords per frame
+		}
+
+		// per frame x, y, width, height in pixels, pivot x, pivot y, pixels per unit
+		public const int FrameWords = 7;
+
+		static void Pack(AtlasDesc atlas)
+		{
+			var paths = new string[atlas.Count];
+			for (int i = 0; i < atlas.Count; ++i)
+			{
+				paths[i] = ResourcesDir + string.Format(atlas.Format, atlas.First + i) + ".png";
+			}
+			Atlas packed = Build(paths, true);
+
+			using (var table = new BinaryWriter(File.Create(AtlasDir + atlas.Name + ".bytes")))
+			{
+				table.Write(AtlasMagic);
+				table.Write(AtlasVersion);
+				table.Write(atlas.Count);
+				table.Write(packed.Width);
+				table.Write(packed.Height);
+				foreach (float word in packed.Frames)
+				{
+					table.Write(word);
+				}
+			}
+
+			var texture = new Texture2D(packed.Width, packed.Height, TextureFormat.RGBA32, false);
+			texture.SetPixels32(packed.Pixels);
+			File.WriteAllBytes(AtlasDir + atlas.Name + ".png", texture.EncodeToPNG());
+			UnityEngine.Object.DestroyImmediate(texture);
+
+			Debug.Log("Packed " + atlas.Count + " frames into " + atlas.Name + ", " + packed.Width + "x" + packed.Height);
+		}
+
+		/// Pack the sprite PNGs at 'paths' on a square-ish grid, on the
+		/// smallest power of two that fits if 'powerOfTwo'
+		public static Atlas Build(string[] paths, bool powerOfTwo)
+		{
+			// read the source PNGs directly, so their import settings don't matter
+			int count = paths.Length;
+			var frames = new Texture2D[count];
+			var pivots = new Vector2[count];
+			var pixelsPerUnit = new float[count];
+			int cellWidth = 0;
+			int cellHeight = 0;
+			for (int i = 0; i < count; ++i)
+			{
+				frames[i] = new Texture2D(2, 2, TextureFormat.RGBA32, false);
+				if (!frames[i].LoadImage(File.ReadAllBytes(paths[i])))
+				{
+					throw new Exception("Can't read atlas frame " + paths[i]);
+				}
+				var importer = (TextureImporter)AssetImporter.GetAtPath(paths[i]);
+				pivots[i] = importer.spritePivot;
+				pixelsPerUnit[i] = importer.spritePixelsPerUnit;
+				cellWidth = Math.Max(cellWidth, frames[i].width + Padding * 2);
+				cellHeight = Math.Max(cellHeight, frames[i].height + Padding * 2);
+			}
+
+			int columns = (int)Math.Ceiling(Math.Sqrt(count));
+			int rows = (count + columns - 1) / columns;
+			var atlas = new Atlas();
+			atlas.Width = powerOfTwo ? Mathf.NextPowerOfTwo(columns * cellWidth) : columns * cellWidth;
+			atlas.Height = powerOfTwo ? Mathf.NextPowerOfTwo(rows * cellHeight) : rows * cellHeight;
+			atlas.Pixels = new Color32[atlas.Width * atlas.Height];
+			atlas.Frames = new float[count * FrameWords];
+
+			for (int i = 0; i < count; ++i)
+			{
+				Texture2D frame = frames[i];
+				int x = (i % columns) * cellWidth + Padding;
+				int y = (i / columns) * cellHeight + Padding;
+				Blit(frame.GetPixels32(), frame.width, frame.height, atlas.Pixels, atlas.Width, x, y);
+
+				int word = i * FrameWords;
+				atlas.Frames[word] = x;
+				atlas.Frames[word + 1] = y;
+				atlas.Frames[word + 2] = frame.width;
+				atlas.Frames[word + 3] = frame.height;
+				atlas.Frames[word + 4] = pivots[i].x;
+				atlas.Frames[word + 5] = pivots[i].y;
+				atlas.Frames[word + 6] = pixelsPerUnit[i];
+				UnityEngine.Object.DestroyImmediate(frame);
+			}
+			return atlas;
+		}
+
+		/// Copy a frame to (x, y) and repeat its edge pixels out into the padding
+		static void Blit(Color32[] src, int srcWidth, int srcHeight, Color32[] dst, int dstWidth, int x, int y)
+		{
+			for (int row = -Padding; row < srcHeight + Padding; ++row)
+			{
+				int srcRow = Mathf.Clamp(row, 0, srcHeight - 1);
+				for (int col = -Padding; col < srcWidth + Padding; ++col)
+				{
+					int srcCol = Mathf.Clamp(col, 0, srcWidth - 1);
+					dst[(y + row) * dstWidth + x + col] = src[srcRow * srcWidth + srcCol];
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+using UnityEngine;
+
+namespace MyGame
+{
+	/// Plays the native mixer's output. Sits on the AudioListener and adds
+	/// whatever the mixer has written to its ring since the last callback.
+	/// Runs on the audio thread, so it only touches the ring's memory and
+	/// never calls into native code
+	public class NativeAudioStream : MonoBehaviour
+	{
+		// ring layout. Must match Mixer::Ring in Mixer.h
+		//   uint write position, uint read position, each on its own cache
+		//   line, then interleaved stereo float samples
+		const int WritePosOffset = 0;
+		const int ReadPosOffset = 64;
+		const int SamplesOffset = 128;
+		const int RingChannels = 2;
+
+		static readonly object ringLock = new object();
+		static IntPtr ring = IntPtr.Zero;
+		static int ringFrames;
+
+		float[] scratch = new float[0];
+
+		/// Start reading from a ring of 'frames' frames, or stop if it's
+		/// zero. The old ring is no longer touched once this returns
+		public static void Attach(IntPtr newRing, int frames)
+		{
+			lock (ringLock)
+			{
+				ring = newRing;
+				ringFrames = frames;
+			}
+		}
+
+		void OnAudioFilterRead(float[] data, int channels)
+		{
+			lock (ringLock)
+			{
+				if (ring == IntPtr.Zero)
+				{
+					return;
+				}
+
+				// the samples up to the write position are ready once it's read
+				uint writePos = (uint)Marshal.ReadInt32(ring, WritePosOffset);
+				Thread.MemoryBarrier();
+				uint readPos = (uint)Marshal.ReadInt32(ring, ReadPosOffset);
+				int available = (int)(writePos - readPos);
+				if (available <= 0 || available > ringFrames)
+				{
+					return;
+				}
+
+				int frames = Math.Min(data.Length / channels, available);
+				if (scratch.Length < frames * RingChannels)
+				{
+					scratch = new float[frames * RingChannels];
+				}
+
+				// up to the end of the ring, then around
+				int at = (int)(readPos & (uint)(ringFrames - 1));
+				int first = Math.Min(frames, ringFrames - at);
+				long samples = ring.ToInt64() + SamplesOffset;
+				Marshal.Copy(new IntPtr(samples + at * RingChannels * 4), scratch, 0, first * RingChannels);
+				if (frames > first)
+				{
+					Marshal.Copy(new IntPtr(samples), scratch, first * RingChannels, (frames - first) * RingChannels);
+				}
+
+				for (int i = 0; i < frames; ++i)
+				{
+					float left = scratch[i * RingChannels];
+					float right = scratch[i * RingChannels + 1];
+					int frame = i * channels;
+					if (channels == 1)
+					{
+						data[frame] += (left + right) * 0.5f;
+					}
+					else
+					{
+						data[frame] += left;
+						data[frame + 1] += right;
+					}
+				}
+
+				// done with the samples before the mixer can overwrite them
+				Thread.MemoryBarrier();
+				Marshal.WriteInt32(ring, ReadPosOffset, (int)(readPos + (uint)frames));
+			}
+		}
+	}
+}
@@ -0,0 +1,775 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using UnityEngine;
+
+namespace MyGame
+{
+	/// Batched engine calls for the native game. Each method does the work
+	/// of many single bindings so C++ pays for one transition per batch.
+	public static class NativeBatch
+	{
+		// Archetype flags. Must match SpawnBatch::Flags in SpawnBatch.h
+		const int FlagAudio = 1;		// add an AudioSource
+		const int FlagLoopAudio = 2;	// loop the spawn clip instead of playing it once
+
+		// Spawn descriptor layout. Must match SpawnBatch::Desc in SpawnBatch.h
+		//   int slot, int archetype, float x, float y, float z, int sprite index, int clip
+		const int SpawnDescWords = 7;
+
+		// sprite command layout. Must match SpriteTable::Command in SpriteTable.h
+		//   int slot, int sprite index
+		const int SpriteCommandWords = 2;
+
+		// position command layout. Must match TransformBuffer::Command in TransformBuffer.h
+		//   int slot, float x, float y, float z
+		const int PositionCommandWords = 4;
+
+		// sound command layout. Must match FrameCommands::SoundCommand in FrameCommands.h
+		//   int slot, int clip handle
+		const int SoundCommandWords = 2;
+
+		// sprite bounds layout. Must match SpriteTable::SpriteBounds in SpriteTable.h
+		//   float center x, float center y, float extent x, float extent y
+		const int SpriteBoundsWords = 4;
+
+		// sprite UV layout. Must match SpriteTable::SpriteUV in SpriteTable.h
+		//   float u0, float v0, float u1, float v1, int texture index
+		const int SpriteUVWords = 5;
+
+		// atlas table layout. Must match AtlasPacker.cs
+		//   int magic, int version, int frames, int width, int height, then
+		//   per frame float x, float y, float width, float height in pixels,
+		//   float pivot x, float pivot y, float pixels per unit
+		const int AtlasMagic = 0x534C5441;	// "ATLS"
+		const int AtlasVersion = 1;
+
+		// asset pack frame layout. Must match AssetPack::FrameWords in AssetPack.h
+		//   float x, float y, float width, float height in pixels,
+		//   float pivot x, float pivot y, float pixels per unit
+		const int PackFrameWords = 7;
+
+		// sprite layer layout. Must match SpriteBatcher::LayerDesc in SpriteBatcher.h
+		//   int layer, int quads, int ranges, int pad, long vertices, long ranges
+		const int LayerDescBytes = 32;
+
+		// vertex layout. Must match SpriteBatcher::Vertex in SpriteBatcher.h
+		//   float x, float y, float z, float u, float v
+		const int VertexWords = 5;
+
+		// quad range layout. Must match SpriteBatcher::Range in SpriteBatcher.h
+		//   int texture index, int first quad, int quads
+		const int RangeWords = 3;
+
+		static string[] archetypeNames = new string[8];
+		static int[] archetypeFlags = new int[8];
+
+		// sprites native code refers to by index
+		static List<Sprite> spriteTable = new List<Sprite>();
+
+		// textures the sprite table uses, in the order GetSpriteUVs numbered
+		// them, and a sprite material for each
+		static List<Texture2D> textures = new List<Texture2D>();
+		static Dictionary<Texture2D, int> textureIndices = new Dictionary<Texture2D, int>();
+		static List<Material> textureMaterials = new List<Material>();
+
+		// one mesh per sprite layer, made the first time the layer is drawn
+		static List<Mesh> layerMeshes = new List<Mesh>();
+		static List<MeshRenderer> layerRenderers = new List<MeshRenderer>();
+
+		// an in-flight Resources.LoadAsync and where its result goes
+		struct PendingLoad
+		{
+			public ResourceRequest Request;
+			public int SpriteIndex;		// sprite table index, -1 for a clip
+			public IntPtr ClipHandle;	// native int that receives the clip handle
+			public byte[] AtlasTable;	// frame table when loading an atlas texture
+		}
+		static List<PendingLoad> pendingLoads = new List<PendingLoad>();
+		static int numLoadsIssued;
+		static int numLoadsDone;
+
+		// spawned objects by slot. native code picks the slots
+		static GameObject[] objects = new GameObject[256];
+		static SpriteRenderer[] renderers = new SpriteRenderer[256];
+		static AudioSource[] audioSources = new AudioSource[256];
+
+		// scratch buffers reused between batches
+		static int[] spawnInts = new int[0];
+		static float[] spawnFloats = new float[0];
+		static int[] spriteHandles = new int[0];
+		static int[] spriteCommands = new int[0];
+		static int[] positionInts = new int[0];
+		static float[] positionFloats = new float[0];
+		static int[] soundCommands = new int[0];
+		static int[] destroySlots = new int[0];
+		static int[] destroyHandles = new int[0];
+		static float[] vertexWords = new float[0];
+		static int[] rangeWords = new int[0];
+		static List<Vector3> layerVertices = new List<Vector3>();
+		static List<Vector2> layerUVs = new List<Vector2>();
+		static List<int> layerTriangles = new List<int>();
+		static Material[][] layerMaterials = new Material[0][];
+
+		public static void RegisterArchetype(int archetype, string name, int flags)
+		{
+			if (archetype >= archetypeNames.Length)
+			{
+				int newSize = Math.Max(archetype + 1, archetypeNames.Length * 2);
+				Array.Resize(ref archetypeNames, newSize);
+				Array.Resize(ref archetypeFlags, newSize);
+			}
+			archetypeNames[archetype] = name;
+			archetypeFlags[archetype] = flags;
+		}
+
+		/// Add sprites, given as object store handles, to the sprite table.
+		/// Returns the table index of the first one.
+		public static int RegisterSprites(IntPtr handles, int count)
+		{
+			if (spriteHandles.Length < count)
+			{
+				spriteHandles = new int[count];
+			}
+			Marshal.Copy(handles, spriteHandles, 0, count);
+
+			int first = spriteTable.Count;
+			for (int i = 0; i < count; ++i)
+			{
+				spriteTable.Add((Sprite)NativeScript.Bindings.ObjectStore.Get(spriteHandles[i]));
+			}
+			return first;
+		}
+
+		/// Load sprites 'first' to 'first + count - 1' of a numbered sequence
+		/// into the sprite table. 'format' is a String.Format pattern such as
+		/// "tile{0:D3}". Returns the table index of the first one.
+		public static int LoadSpriteSequence(string format, int first, int count)
+		{
+			int tableIndex = spriteTable.Count;
+			for (int i = 0; i < count; ++i)
+			{
+				spriteTable.Add(Resources.Load<Sprite>(string.Format(format, first + i)));
+			}
+			return tableIndex;
+		}
+
+		/// Load a newline separated list of sprite paths into the sprite
+		/// table. Returns the table index of the first one.
+		public static int LoadSprites(string manifest)
+		{
+			int tableIndex = spriteTable.Count;
+			foreach (string path in manifest.Split('\n'))
+			{
+				spriteTable.Add(Resources.Load<Sprite>(path));
+			}
+			return tableIndex;
+		}
+
+		/// Load a newline separated list of audio clip paths and write their
+		/// object store handles to 'handles'. Returns the number loaded.
+		public static int LoadClips(string manifest, IntPtr handles)
+		{
+			string[] paths = manifest.Split('\n');
+			int[] clipHandles = new int[paths.Length];
+			for (int i = 0; i < paths.Length; ++i)
+			{
+				clipHandles[i] = NativeScript.Bindings.ObjectStore.Store(
+					Resources.Load<AudioClip>(paths[i]));
+			}
+			Marshal.Copy(clipHandles, 0, handles, paths.Length);
+			return paths.Length;
+		}
+
+		/// Like LoadSpriteSequence, but the table entries stay empty until
+		/// PollLoads reports them done.
+		public static int LoadSpriteSequenceAsync(string format, int first, int count)
+		{
+			int tableIndex = spriteTable.Count;
+			for (int i = 0; i < count; ++i)
+			{
+				LoadSpriteAsync(string.Format(format, first + i));
+			}
+			return tableIndex;
+		}
+
+		/// Like LoadSprites, but the table entries stay empty until PollLoads
+		/// reports them done.
+		public static int LoadSpritesAsync(string manifest)
+		{
+			int tableIndex = spriteTable.Count;
+			foreach (string path in manifest.Split('\n'))
+			{
+				LoadSpriteAsync(path);
+			}
+			return tableIndex;
+		}
+
+		/// Like LoadClips, but each handle is written by PollLoads when its
+		/// clip arrives. 'handles' must stay valid until then.
+		public static int LoadClipsAsync(string manifest, IntPtr handles)
+		{
+			string[] paths = manifest.Split('\n');
+			for (int i = 0; i < paths.Length; ++i)
+			{
+				Marshal.WriteInt32(handles, i * 4, 0);
+				PendingLoad load;
+				load.Request = Resources.LoadAsync<AudioClip>(paths[i]);
+				load.SpriteIndex = -1;
+				load.ClipHandle = new IntPtr(handles.ToInt64() + i * 4);
+				load.AtlasTable = null;
+				pendingLoads.Add(load);
+			}
+			numLoadsIssued += paths.Length;
+			return paths.Length;
+		}
+
+		/// Write the length in seconds of 'count' clips, given as object
+		/// store handles
+		public static void GetClipLengths(IntPtr handles, IntPtr lengths, int count)
+		{
+			int[] clipHandles = new int[count];
+			Marshal.Copy(handles, clipHandles, 0, count);
+			float[] clipLengths = new float[count];
+			for (int i = 0; i < count; ++i)
+			{
+				var clip = (AudioClip)NativeScript.Bindings.ObjectStore.Get(clipHandles[i]);
+				clipLengths[i] = clip.length;
+			}
+			Marshal.Copy(clipLengths, 0, lengths, count);
+		}
+
+		/// Write the directory the sound .wav files are read from, as a
+		/// null terminated UTF-8 path ending in a slash, for the native
+		/// mixer. Returns its length, or 0 if it doesn't fit in 'size' bytes
+		public static int GetSoundDirectory(IntPtr buffer, int size)
+		{
+			// the editor reads them from the project. a player only has
+			// them if they've been copied to streaming assets
+			string directory = Application.isEditor
+				? Application.dataPath + "/Resources/Sounds/"
+				: Application.streamingAssetsPath + "/Sounds/";
+			return WritePath(directory, buffer, size);
+		}
+
+		/// Write the path of the asset pack the AssetPacker builds, as a
+		/// null terminated UTF-8 string. Returns its length, or 0 if it
+		/// doesn't fit in 'size' bytes
+		public static int GetPackPath(IntPtr buffer, int size)
+		{
+			return WritePath(Application.streamingAssetsPath + "/Game.pack", buffer, size);
+		}
+
+		static int WritePath(string path, IntPtr buffer, int size)
+		{
+			byte[] bytes = System.Text.Encoding.UTF8.GetBytes(path);
+			if (bytes.Length + 1 > size)
+			{
+				return 0;
+			}
+			Marshal.Copy(bytes, 0, buffer, bytes.Length);
+			Marshal.WriteByte(buffer, bytes.Length, 0);
+			return bytes.Length;
+		}
+
+		/// Make a texture from 'width' x 'height' RGBA32 pixels in native
+		/// memory, and a sprite for each of 'count' frames of it. Returns the
+		/// sprite table index of the first. Nothing is loaded from Resources
+		public static int AddPackSprites(IntPtr pixels, int width, int height, IntPtr frames, int count)
+		{
+			var texture = new Texture2D(width, height, TextureFormat.RGBA32, false);
+			texture.wrapMode = TextureWrapMode.Clamp;
+			texture.LoadRawTextureData(pixels, width * height * 4);
+
+			float[] words = new float[count * PackFrameWords];
+			Marshal.Copy(frames, words, 0, words.Length);
+			int tableIndex = spriteTable.Count;
+			for (int i = 0; i < count; ++i)
+			{
+				int word = i * PackFrameWords;
+				var rect = new Rect(words[word], words[word + 1], words[word + 2], words[word + 3]);
+				var pivot = new Vector2(words[word + 4], words[word + 5]);
+				spriteTable.Add(Sprite.Create(
+					texture, rect, pivot, words[word + 6], 0, SpriteMeshType.FullRect));
+			}
+
+			// upload and drop the CPU copy, native code still has the pixels
+			texture.Apply(false, true);
+			return tableIndex;
+		}
+
+		/// Make a streamed stereo clip 'frames' long with no data of its
+		/// own, for a sound the native mixer plays from the asset pack.
+		/// Returns its object store handle
+		public static int CreatePackClip(int frames, int sampleRate)
+		{
+			var clip = AudioClip.Create("Packed", frames, 2, sampleRate, true);
+			return NativeScript.Bindings.ObjectStore.Store(clip);
+		}
+
+		/// The rate Unity mixes at, which the native mixer's sounds are
+		/// resampled to
+		public static int GetOutputSampleRate()
+		{
+			return AudioSettings.outputSampleRate;
+		}
+
+		/// Have the AudioListener play the native mixer's ring buffer of
+		/// 'frames' frames, or stop if 'ring' is zero. Native code keeps the
+		/// ring alive until this is called again with zero
+		public static void SetAudioStream(IntPtr ring, int frames)
+		{
+			if (ring != IntPtr.Zero)
+			{
+				var listener = UnityEngine.Object.FindObjectOfType<AudioListener>();
+				if (listener != null && listener.GetComponent<NativeAudioStream>() == null)
+				{
+					listener.gameObject.AddComponent<NativeAudioStream>();
+				}
+			}
+			NativeAudioStream.Attach(ring, frames);
+		}
+
+		/// Store every finished async load. Returns overall progress from 0
+		/// to 1, where 1 means nothing is left in flight.
+		public static float PollLoads()
+		{
+			for (int i = pendingLoads.Count - 1; i >= 0; --i)
+			{
+				PendingLoad load = pendingLoads[i];
+				if (!load.Request.isDone)
+				{
+					continue;
+				}
+				if (load.AtlasTable != null)
+				{
+					AddAtlasSprites((Texture2D)load.Request.asset, load.AtlasTable, load.SpriteIndex);
+				}
+				else if (load.SpriteIndex >= 0)
+				{
+					spriteTable[load.SpriteIndex] = (Sprite)load.Request.asset;
+				}
+				else
+				{
+					Marshal.WriteInt32(load.ClipHandle,
+						NativeScript.Bindings.ObjectStore.Store(load.Request.asset));
+				}
+				pendingLoads.RemoveAt(i);
+				numLoadsDone++;
+			}
+
+			if (numLoadsDone == numLoadsIssued)
+			{
+				return 1.0f;
+			}
+			return (float)numLoadsDone / numLoadsIssued;
+		}
+
+		static void LoadSpriteAsync(string path)
+		{
+			PendingLoad load;
+			load.Request = Resources.LoadAsync<Sprite>(path);
+			load.SpriteIndex = spriteTable.Count;
+			load.ClipHandle = IntPtr.Zero;
+			load.AtlasTable = null;
+			pendingLoads.Add(load);
+			spriteTable.Add(null);
+			numLoadsIssued++;
+		}
+
+		/// Like LoadSpriteSequenceAsync, but the frames come from one atlas
+		/// texture made by the atlases build target, so they all share a
+		/// texture. Falls back to the separate frames if the atlas at 'path'
+		/// hasn't been packed or doesn't hold 'count' frames.
+		public static int LoadAtlasAsync(string path, string format, int first, int count)
+		{
+			TextAsset table = Resources.Load<TextAsset>(path);
+			if (table == null || GetAtlasFrameCount(table.bytes) != count)
+			{
+				Debug.LogWarning("No packed atlas at " + path + ", loading its frames one by one");
+				return LoadSpriteSequenceAsync(format, first, count);
+			}
+
+			int tableIndex = spriteTable.Count;
+			PendingLoad load;
+			load.Request = Resources.LoadAsync<Texture2D>(path);
+			load.SpriteIndex = tableIndex;
+			load.ClipHandle = IntPtr.Zero;
+			load.AtlasTable = table.bytes;
+			pendingLoads.Add(load);
+			for (int i = 0; i < count; ++i)
+			{
+				spriteTable.Add(null);
+			}
+			numLoadsIssued++;
+			return tableIndex;
+		}
+
+		static int GetAtlasFrameCount(byte[] table)
+		{
+			if (table.Length < 12
+				|| BitConverter.ToInt32(table, 0) != AtlasMagic
+				|| BitConverter.ToInt32(table, 4) != AtlasVersion)
+			{
+				return -1;
+			}
+			return BitConverter.ToInt32(table, 8);
+		}
+
+		/// A sprite for each frame of an atlas, in the table entries
+		/// starting at 'tableIndex'
+		static void AddAtlasSprites(Texture2D texture, byte[] table, int tableIndex)
+		{
+			using (var reader = new BinaryReader(new MemoryStream(table)))
+			{
+				reader.ReadInt32();
+				reader.ReadInt32();
+				int count = reader.ReadInt32();
+				reader.ReadInt32();
+				reader.ReadInt32();
+				for (int i = 0; i < count; ++i)
+				{
+					var rect = new Rect(
+						reader.ReadSingle(),
+						reader.ReadSingle(),
+						reader.ReadSingle(),
+						reader.ReadSingle());
+					var pivot = new Vector2(reader.ReadSingle(), reader.ReadSingle());
+					float pixelsPerUnit = reader.ReadSingle();
+					spriteTable[tableIndex + i] = Sprite.Create(
+						texture, rect, pivot, pixelsPerUnit, 0, SpriteMeshType.FullRect);
+				}
+			}
+		}
+
+		/// Apply 'count' (slot, sprite index) commands
+		public static void SetSprites(IntPtr commands, int count)
+		{
+			int numWords = count * SpriteCommandWords;
+			if (spriteCommands.Length < numWords)
+			{
+				spriteCommands = new int[numWords];
+			}
+			Marshal.Copy(commands, spriteCommands, 0, numWords);
+
+			for (int i = 0; i < numWords; i += SpriteCommandWords)
+			{
+				renderers[spriteCommands[i]].sprite = spriteTable[spriteCommands[i + 1]];
+			}
+		}
+
+		/// Apply 'count' (slot, x, y, z) position commands
+		public static void SetPositions(IntPtr commands, int count)
+		{
+			int numWords = count * PositionCommandWords;
+			if (positionInts.Length < numWords)
+			{
+				positionInts = new int[numWords];
+				positionFloats = new float[numWords];
+			}
+			Marshal.Copy(commands, positionInts, 0, numWords);
+			Marshal.Copy(commands, positionFloats, 0, numWords);
+
+			for (int i = 0; i < numWords; i += PositionCommandWords)
+			{
+				renderers[positionInts[i]].transform.position = new Vector3(
+					positionFloats[i + 1],
+					positionFloats[i + 2],
+					positionFloats[i + 3]);
+			}
+		}
+
+		/// Write the local bounds of sprite table entries 'first' to
+		/// 'first + count - 1' so native code can do its own collision
+		public static void GetSpriteBounds(IntPtr bounds, int first, int count)
+		{
+			float[] words = new float[count * SpriteBoundsWords];
+			for (int i = 0; i < count; ++i)
+			{
+				Sprite sprite = spriteTable[first + i];
+				if (sprite == null)
+				{
+					continue;
+				}
+				Bounds b = sprite.bounds;
+				int word = i * SpriteBoundsWords;
+				words[word] = b.center.x;
+				words[word + 1] = b.center.y;
+				words[word + 2] = b.extents.x;
+				words[word + 3] = b.extents.y;
+			}
+			Marshal.Copy(words, 0, bounds, words.Length);
+		}
+
+		/// Write the texture rect of sprite table entries 'first' to
+		/// 'first + count - 1' as UVs, with the index of the texture it's in.
+		/// Returns how many textures the sprite table uses
+		public static int GetSpriteUVs(IntPtr uvs, int first, int count)
+		{
+			float[] words = new float[count * SpriteUVWords];
+			int[] textureIds = new int[count];
+			for (int i = 0; i < count; ++i)
+			{
+				Sprite sprite = spriteTable[first + i];
+				if (sprite == null)
+				{
+					continue;
+				}
+				Texture2D texture = sprite.texture;
+				int index;
+				if (!textureIndices.TryGetValue(texture, out index))
+				{
+					index = textures.Count;
+					textures.Add(texture);
+					textureIndices.Add(texture, index);
+					var material = new Material(Shader.Find("Sprites/Default"));
+					material.mainTexture = texture;
+					textureMaterials.Add(material);
+				}
+				Rect r = sprite.textureRect;
+				int word = i * SpriteUVWords;
+				words[word] = r.xMin / texture.width;
+				words[word + 1] = r.yMin / texture.height;
+				words[word + 2] = r.xMax / texture.width;
+				words[word + 3] = r.yMax / texture.height;
+				textureIds[i] = index;
+			}
+
+			// the texture index is an int among the floats, write it on its own
+			Marshal.Copy(words, 0, uvs, words.Length);
+			for (int i = 0; i < count; ++i)
+			{
+				Marshal.WriteInt32(uvs, (i * SpriteUVWords + SpriteUVWords - 1) * 4, textureIds[i]);
+			}
+			return textures.Count;
+		}
+
+		/// Upload 'count' sprite layers, each to its own mesh with one
+		/// submesh per texture
+		public static void DrawSprites(IntPtr layers, int count)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				IntPtr desc = new IntPtr(layers.ToInt64() + i * LayerDescBytes);
+				int layer = Marshal.ReadInt32(desc, 0);
+				int numQuads = Marshal.ReadInt32(desc, 4);
+				int numRanges = Marshal.ReadInt32(desc, 8);
+				IntPtr vertices = new IntPtr(Marshal.ReadInt64(desc, 16));
+				IntPtr ranges = new IntPtr(Marshal.ReadInt64(desc, 24));
+
+				Mesh mesh = GetLayerMesh(layer);
+				mesh.Clear();
+				if (numQuads == 0)
+				{
+					continue;
+				}
+
+				int numVertexWords = numQuads * 4 * VertexWords;
+				if (vertexWords.Length < numVertexWords)
+				{
+					vertexWords = new float[numVertexWords];
+				}
+				Marshal.Copy(vertices, vertexWords, 0, numVertexWords);
+				layerVertices.Clear();
+				layerUVs.Clear();
+				for (int w = 0; w < numVertexWords; w += VertexWords)
+				{
+					layerVertices.Add(new Vector3(vertexWords[w], vertexWords[w + 1], vertexWords[w + 2]));
+					layerUVs.Add(new Vector2(vertexWords[w + 3], vertexWords[w + 4]));
+				}
+				mesh.SetVertices(layerVertices);
+				mesh.SetUVs(0, layerUVs);
+
+				int numRangeWords = numRanges * RangeWords;
+				if (rangeWords.Length < numRangeWords)
+				{
+					rangeWords = new int[numRangeWords];
+				}
+				Marshal.Copy(ranges, rangeWords, 0, numRangeWords);
+				if (layerMaterials[layer].Length != numRanges)
+				{
+					layerMaterials[layer] = new Material[numRanges];
+				}
+				mesh.subMeshCount = numRanges;
+				for (int r = 0; r < numRanges; ++r)
+				{
+					int word = r * RangeWords;
+					int firstQuad = rangeWords[word + 1];
+					int rangeQuads = rangeWords[word + 2];
+					layerTriangles.Clear();
+					for (int q = firstQuad; q < firstQuad + rangeQuads; ++q)
+					{
+						int b = q * 4;
+						layerTriangles.Add(b);
+						layerTriangles.Add(b + 1);
+						layerTriangles.Add(b + 2);
+						layerTriangles.Add(b);
+						layerTriangles.Add(b + 2);
+						layerTriangles.Add(b + 3);
+					}
+					mesh.SetTriangles(layerTriangles, r);
+					layerMaterials[layer][r] = textureMaterials[rangeWords[word]];
+				}
+				layerRenderers[layer].sharedMaterials = layerMaterials[layer];
+			}
+		}
+
+		static Mesh GetLayerMesh(int layer)
+		{
+			while (layerMeshes.Count <= layer)
+			{
+				int index = layerMeshes.Count;
+				var go = new GameObject("Sprite Layer " + index);
+				var mesh = new Mesh();
+				mesh.MarkDynamic();
+				mesh.indexFormat = UnityEngine.Rendering.IndexFormat.UInt32;
+				go.AddComponent<MeshFilter>().sharedMesh = mesh;
+				var renderer = go.AddComponent<MeshRenderer>();
+				renderer.sortingOrder = index;
+				layerMeshes.Add(mesh);
+				layerRenderers.Add(renderer);
+			}
+			if (layerMaterials.Length < layerMeshes.Count)
+			{
+				Array.Resize(ref layerMaterials, layerMeshes.Count);
+				for (int i = 0; i < layerMaterials.Length; ++i)
+				{
+					if (layerMaterials[i] == null)
+					{
+						layerMaterials[i] = new Material[0];
+					}
+				}
+			}
+			return layerMeshes[layer];
+		}
+
+		/// Write the world space rect the main camera sees of the z = 0
+		/// plane, where gameplay happens, as min x, min y, max x, max y
+		public static void GetViewRect(IntPtr rect)
+		{
+			Camera camera = Camera.main;
+			Vector3 center = camera.transform.position;
+			float extentY = camera.orthographic
+				? camera.orthographicSize
+				: Mathf.Abs(center.z) * Mathf.Tan(camera.fieldOfView * 0.5f * Mathf.Deg2Rad);
+			float extentX = extentY * camera.aspect;
+			float[] words = {
+				center.x - extentX,
+				center.y - extentY,
+				center.x + extentX,
+				center.y + extentY };
+			Marshal.Copy(words, 0, rect, words.Length);
+		}
+
+		/// Create 'count' GameObjects from the descriptors, each in the slot
+		/// its descriptor names
+		public static void Spawn(IntPtr descriptors, int count)
+		{
+			int numWords = count * SpawnDescWords;
+			if (spawnInts.Length < numWords)
+			{
+				spawnInts = new int[numWords];
+				spawnFloats = new float[numWords];
+			}
+
+			// descriptors mix ints and floats, so copy them out both ways
+			Marshal.Copy(descriptors, spawnInts, 0, numWords);
+			Marshal.Copy(descriptors, spawnFloats, 0, numWords);
+
+			for (int i = 0; i < count; ++i)
+			{
+				int desc = i * SpawnDescWords;
+				int slot = spawnInts[desc];
+				int archetype = spawnInts[desc + 1];
+				int flags = archetypeFlags[archetype];
+
+				var go = new GameObject(archetypeNames[archetype]);
+				go.transform.position = new Vector3(
+					spawnFloats[desc + 2],
+					spawnFloats[desc + 3],
+					spawnFloats[desc + 4]);
+
+				var renderer = go.AddComponent<SpriteRenderer>();
+				renderer.sprite = spriteTable[spawnInts[desc + 5]];
+
+				AudioSource source = null;
+				if ((flags & FlagAudio) != 0)
+				{
+					source = go.AddComponent<AudioSource>();
+					int clip = spawnInts[desc + 6];
+					if (clip != 0)
+					{
+						source.clip = (AudioClip)NativeScript.Bindings.ObjectStore.Get(clip);
+						source.loop = (flags & FlagLoopAudio) != 0;
+						source.Play();
+					}
+				}
+
+				if (slot >= objects.Length)
+				{
+					int newSize = Math.Max(slot + 1, objects.Length * 2);
+					Array.Resize(ref objects, newSize);
+					Array.Resize(ref renderers, newSize);
+					Array.Resize(ref audioSources, newSize);
+				}
+				objects[slot] = go;
+				renderers[slot] = renderer;
+				audioSources[slot] = source;
+			}
+		}
+
+		/// Play 'count' (slot, clip handle) one shots on the slots' AudioSources
+		public static void PlayOneShots(IntPtr commands, int count)
+		{
+			int numWords = count * SoundCommandWords;
+			if (soundCommands.Length < numWords)
+			{
+				soundCommands = new int[numWords];
+			}
+			Marshal.Copy(commands, soundCommands, 0, numWords);
+
+			for (int i = 0; i < numWords; i += SoundCommandWords)
+			{
+				audioSources[soundCommands[i]].PlayOneShot(
+					(AudioClip)NativeScript.Bindings.ObjectStore.Get(soundCommands[i + 1]));
+			}
+		}
+
+		/// Destroy the GameObjects in 'count' slots and empty the slots
+		public static void Destroy(IntPtr slots, int count)
+		{
+			if (destroySlots.Length < count)
+			{
+				destroySlots = new int[count];
+			}
+			Marshal.Copy(slots, destroySlots, 0, count);
+
+			for (int i = 0; i < count; ++i)
+			{
+				int slot = destroySlots[i];
+				UnityEngine.Object.Destroy(objects[slot]);
+				objects[slot] = null;
+				renderers[slot] = null;
+				audioSources[slot] = null;
+			}
+		}
+
+		/// Destroy 'count' objects given as object store handles. Native code
+		/// keeps the handles alive until this returns
+		public static void DestroyMany(IntPtr handles, int count)
+		{
+			if (destroyHandles.Length < count)
+			{
+				destroyHandles = new int[count];
+			}
+			Marshal.Copy(handles, destroyHandles, 0, count);
+
+			for (int i = 0; i < count; ++i)
+			{
+				UnityEngine.Object.Destroy(
+					(UnityEngine.Object)NativeScript.Bindings.ObjectStore.Get(destroyHandles[i]));
+			}
+		}
+	}
+}
@@ -466,6 +466,8 @@ namespace NativeScript
 		delegate void SetExceptionDelegateType(int handle);
 		delegate int ArrayGetLengthDelegateType(int handle);
 		delegate int EnumerableGetEnumeratorDelegateType(int handle);
+		delegate IntPtr ArrayPinDelegateType(int handle, int byteOffset, int byteCount, ref IntPtr address);
+		delegate void ArrayUnpinDelegateType(IntPtr pin);
 		
 		/*BEGIN DELEGATE TYPES*/
 		delegate void ReleaseSystemDecimalDelegateType(int handle);
@@ -513,6 +515,8 @@ namespace NativeScript
 		delegate bool UnityEngineGameObjectMethodCompareTagSystemStringDelegateType(int thisHandle, int tagHandle);
 		delegate int UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveTypeDelegateType(UnityEngine.PrimitiveType type);
 		delegate void UnityEngineDebugMethodLogSystemObjectDelegateType(int messageHandle);
+		delegate void UnityEngineDebugMethodLogWarningSystemObjectDelegateType(int messageHandle);
+		delegate void UnityEngineDebugMethodLogErrorSystemObjectDelegateType(int messageHandle);
 		delegate int UnityEngineAudioClipConstructorDelegateType();
 		delegate bool UnityEngineAudioSourcePropertyGetLoopDelegateType(int thisHandle);
 		delegate void UnityEngineAudioSourcePropertySetLoopDelegateType(int thisHandle, bool value);
@@ -538,6 +542,33 @@ namespace NativeScript
 		delegate void UnityEngineSpriteRendererPropertySetSpriteDelegateType(int thisHandle, int valueHandle);
 		delegate int UnityEngineSpriteRendererPropertyGetBoundsDelegateType(int thisHandle);
 		delegate float UnityEngineTimePropertyGetDeltaTimeDelegateType();
+		delegate void MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32DelegateType(int archetype, int nameHandle, int flags);
+		delegate int MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32DelegateType(System.IntPtr handles, int count);
+		delegate void MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32DelegateType(System.IntPtr commands, int count);
+		delegate int MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32DelegateType(int formatHandle, int first, int count);
+		delegate int MyGameNativeBatchMethodLoadSpritesSystemStringDelegateType(int manifestHandle);
+		delegate int MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtrDelegateType(int manifestHandle, System.IntPtr handles);
+		delegate int MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32DelegateType(int formatHandle, int first, int count);
+		delegate int MyGameNativeBatchMethodLoadSpritesAsyncSystemStringDelegateType(int manifestHandle);
+		delegate int MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtrDelegateType(int manifestHandle, System.IntPtr handles);
+		delegate float MyGameNativeBatchMethodPollLoadsDelegateType();
+		delegate void MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32DelegateType(System.IntPtr commands, int count);
+		delegate void MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32DelegateType(System.IntPtr bounds, int first, int count);
+		delegate void MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32DelegateType(System.IntPtr descriptors, int count);
+		delegate void MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32DelegateType(System.IntPtr slots, int count);
+		delegate void MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32DelegateType(System.IntPtr commands, int count);
+		delegate void MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32DelegateType(System.IntPtr handles, int count);
+		delegate int MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32DelegateType(System.IntPtr uvs, int first, int count);
+		delegate void MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32DelegateType(System.IntPtr layers, int count);
+		delegate int MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32DelegateType(int pathHandle, int formatHandle, int first, int count);
+		delegate void MyGameNativeBatchMethodGetViewRectSystemIntPtrDelegateType(System.IntPtr rect);
+		delegate void MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32DelegateType(System.IntPtr handles, System.IntPtr lengths, int count);
+		delegate int MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32DelegateType(System.IntPtr buffer, int size);
+		delegate int MyGameNativeBatchMethodGetOutputSampleRateDelegateType();
+		delegate void MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32DelegateType(System.IntPtr ring, int frames);
+		delegate int MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32DelegateType(System.IntPtr buffer, int size);
+		delegate int MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32DelegateType(System.IntPtr pixels, int width, int height, System.IntPtr frames, int count);
+		delegate int MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32DelegateType(int frames, int sampleRate);
 		delegate void BaseGameScriptConstructorDelegateType(int cppHandle, ref int handle);
 		delegate void ReleaseBaseGameScriptDelegateType(int handle);
 		delegate int BoxBooleanDelegateType(bool val);
@@ -564,6 +595,10 @@ namespace NativeScript
 		delegate float UnboxSingleDelegateType(int valHandle);
 		delegate int BoxDoubleDelegateType(double val);
 		delegate double UnboxDoubleDelegateType(int valHandle);
+		delegate int SystemSystemSingleArray2Constructor2DelegateType(int length0, int length1);
+		delegate int SystemSystemSingleArray2GetLength2DelegateType(int thisHandle, int dimension);
+		delegate float SystemSingleArray2GetItem2DelegateType(int thisHandle, int index0, int index1);
+		delegate void SystemSingleArray2SetItem2DelegateType(int thisHandle, int index0, int index1, float item);
 		/*END DELEGATE TYPES*/
 
 #if UNITY_EDITOR_WIN
@@ -587,6 +622,8 @@ namespace NativeScript
 		static readonly SetExceptionDelegateType SetExceptionDelegate = new SetExceptionDelegateType(SetException);
 		static readonly ArrayGetLengthDelegateType ArrayGetLengthDelegate = new ArrayGetLengthDelegateType(ArrayGetLength);
 		static readonly EnumerableGetEnumeratorDelegateType EnumerableGetEnumeratorDelegate = new EnumerableGetEnumeratorDelegateType(EnumerableGetEnumerator);
+		static readonly ArrayPinDelegateType ArrayPinDelegate = new ArrayPinDelegateType(ArrayPin);
+		static readonly ArrayUnpinDelegateType ArrayUnpinDelegate = new ArrayUnpinDelegateType(ArrayUnpin);
 		
 		// Generated delegates
 		/*BEGIN CSHARP DELEGATES*/
@@ -635,6 +672,8 @@ namespace NativeScript
 		static readonly UnityEngineGameObjectMethodCompareTagSystemStringDelegateType UnityEngineGameObjectMethodCompareTagSystemStringDelegate = new UnityEngineGameObjectMethodCompareTagSystemStringDelegateType(UnityEngineGameObjectMethodCompareTagSystemString);
 		static readonly UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveTypeDelegateType UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveTypeDelegate = new UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveTypeDelegateType(UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveType);
 		static readonly UnityEngineDebugMethodLogSystemObjectDelegateType UnityEngineDebugMethodLogSystemObjectDelegate = new UnityEngineDebugMethodLogSystemObjectDelegateType(UnityEngineDebugMethodLogSystemObject);
+		static readonly UnityEngineDebugMethodLogWarningSystemObjectDelegateType UnityEngineDebugMethodLogWarningSystemObjectDelegate = new UnityEngineDebugMethodLogWarningSystemObjectDelegateType(UnityEngineDebugMethodLogWarningSystemObject);
+		static readonly UnityEngineDebugMethodLogErrorSystemObjectDelegateType UnityEngineDebugMethodLogErrorSystemObjectDelegate = new UnityEngineDebugMethodLogErrorSystemObjectDelegateType(UnityEngineDebugMethodLogErrorSystemObject);
 		static readonly UnityEngineAudioClipConstructorDelegateType UnityEngineAudioClipConstructorDelegate = new UnityEngineAudioClipConstructorDelegateType(UnityEngineAudioClipConstructor);
 		static readonly UnityEngineAudioSourcePropertyGetLoopDelegateType UnityEngineAudioSourcePropertyGetLoopDelegate = new UnityEngineAudioSourcePropertyGetLoopDelegateType(UnityEngineAudioSourcePropertyGetLoop);
 		static readonly UnityEngineAudioSourcePropertySetLoopDelegateType UnityEngineAudioSourcePropertySetLoopDelegate = new UnityEngineAudioSourcePropertySetLoopDelegateType(UnityEngineAudioSourcePropertySetLoop);
@@ -660,6 +699,33 @@ namespace NativeScript
 		static readonly UnityEngineSpriteRendererPropertySetSpriteDelegateType UnityEngineSpriteRendererPropertySetSpriteDelegate = new UnityEngineSpriteRendererPropertySetSpriteDelegateType(UnityEngineSpriteRendererPropertySetSprite);
 		static readonly UnityEngineSpriteRendererPropertyGetBoundsDelegateType UnityEngineSpriteRendererPropertyGetBoundsDelegate = new UnityEngineSpriteRendererPropertyGetBoundsDelegateType(UnityEngineSpriteRendererPropertyGetBounds);
 		static readonly UnityEngineTimePropertyGetDeltaTimeDelegateType UnityEngineTimePropertyGetDeltaTimeDelegate = new UnityEngineTimePropertyGetDeltaTimeDelegateType(UnityEngineTimePropertyGetDeltaTime);
+		static readonly MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32DelegateType MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32Delegate = new MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32DelegateType(MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32);
+		static readonly MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32DelegateType MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32Delegate = new MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32DelegateType(MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32);
+		static readonly MyGameNativeBatchMethodLoadSpritesSystemStringDelegateType MyGameNativeBatchMethodLoadSpritesSystemStringDelegate = new MyGameNativeBatchMethodLoadSpritesSystemStringDelegateType(MyGameNativeBatchMethodLoadSpritesSystemString);
+		static readonly MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtrDelegateType MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtrDelegate = new MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtrDelegateType(MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtr);
+		static readonly MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32DelegateType MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32Delegate = new MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32DelegateType(MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32);
+		static readonly MyGameNativeBatchMethodLoadSpritesAsyncSystemStringDelegateType MyGameNativeBatchMethodLoadSpritesAsyncSystemStringDelegate = new MyGameNativeBatchMethodLoadSpritesAsyncSystemStringDelegateType(MyGameNativeBatchMethodLoadSpritesAsyncSystemString);
+		static readonly MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtrDelegateType MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtrDelegate = new MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtrDelegateType(MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtr);
+		static readonly MyGameNativeBatchMethodPollLoadsDelegateType MyGameNativeBatchMethodPollLoadsDelegate = new MyGameNativeBatchMethodPollLoadsDelegateType(MyGameNativeBatchMethodPollLoads);
+		static readonly MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32DelegateType MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32Delegate = new MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32DelegateType(MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32);
+		static readonly MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32DelegateType MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32Delegate = new MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32DelegateType(MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32);
+		static readonly MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32DelegateType MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32Delegate = new MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32DelegateType(MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32);
+		static readonly MyGameNativeBatchMethodGetViewRectSystemIntPtrDelegateType MyGameNativeBatchMethodGetViewRectSystemIntPtrDelegate = new MyGameNativeBatchMethodGetViewRectSystemIntPtrDelegateType(MyGameNativeBatchMethodGetViewRectSystemIntPtr);
+		static readonly MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodGetOutputSampleRateDelegateType MyGameNativeBatchMethodGetOutputSampleRateDelegate = new MyGameNativeBatchMethodGetOutputSampleRateDelegateType(MyGameNativeBatchMethodGetOutputSampleRate);
+		static readonly MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32DelegateType MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32Delegate = new MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32DelegateType(MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32);
+		static readonly MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32DelegateType MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32Delegate = new MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32DelegateType(MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32);
 		static readonly ReleaseBaseGameScriptDelegateType ReleaseBaseGameScriptDelegate = new ReleaseBaseGameScriptDelegateType(ReleaseBaseGameScript);
 		static readonly BaseGameScriptConstructorDelegateType BaseGameScriptConstructorDelegate = new BaseGameScriptConstructorDelegateType(BaseGameScriptConstructor);
 		static readonly BoxBooleanDelegateType BoxBooleanDelegate = new BoxBooleanDelegateType(BoxBoolean);
@@ -686,6 +752,10 @@ namespace NativeScript
 		static readonly UnboxSingleDelegateType UnboxSingleDelegate = new UnboxSingleDelegateType(UnboxSingle);
 		static readonly BoxDoubleDelegateType BoxDoubleDelegate = new BoxDoubleDelegateType(BoxDouble);
 		static readonly UnboxDoubleDelegateType UnboxDoubleDelegate = new UnboxDoubleDelegateType(UnboxDouble);
+		static readonly SystemSystemSingleArray2Constructor2DelegateType SystemSystemSingleArray2Constructor2Delegate = new SystemSystemSingleArray2Constructor2DelegateType(SystemSystemSingleArray2Constructor2);
+		static readonly SystemSystemSingleArray2GetLength2DelegateType SystemSystemSingleArray2GetLength2Delegate = new SystemSystemSingleArray2GetLength2DelegateType(SystemSystemSingleArray2GetLength2);
+		static readonly SystemSingleArray2GetItem2DelegateType SystemSingleArray2GetItem2Delegate = new SystemSingleArray2GetItem2DelegateType(SystemSingleArray2GetItem2);
+		static readonly SystemSingleArray2SetItem2DelegateType SystemSingleArray2SetItem2Delegate = new SystemSingleArray2SetItem2DelegateType(SystemSingleArray2SetItem2);
 		/*END CSHARP DELEGATES*/
 		
 		/// <summary>
@@ -827,6 +897,16 @@ namespace NativeScript
 				curMemory,
 				Marshal.GetFunctionPointerForDelegate(EnumerableGetEnumeratorDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(ArrayPinDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(ArrayUnpinDelegate));
+			curMemory += IntPtr.Size;
 			
 			/*BEGIN INIT CALL*/
 			Marshal.WriteInt32(memory, curMemory, 1000); // max managed objects
@@ -921,6 +1001,10 @@ namespace NativeScript
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineDebugMethodLogSystemObjectDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineDebugMethodLogWarningSystemObjectDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineDebugMethodLogErrorSystemObjectDelegate));
+			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineAudioClipConstructorDelegate));
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineAudioSourcePropertyGetLoopDelegate));
@@ -971,6 +1055,60 @@ namespace NativeScript
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineTimePropertyGetDeltaTimeDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadSpritesSystemStringDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtrDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadSpritesAsyncSystemStringDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtrDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodPollLoadsDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetViewRectSystemIntPtrDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetOutputSampleRateDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32Delegate));
+			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(ReleaseBaseGameScriptDelegate));
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(BaseGameScriptConstructorDelegate));
@@ -1023,6 +1161,14 @@ namespace NativeScript
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnboxDoubleDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemSystemSingleArray2Constructor2Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemSystemSingleArray2GetLength2Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemSingleArray2GetItem2Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemSingleArray2SetItem2Delegate));
+			curMemory += IntPtr.Size;
 			/*END INIT CALL*/
 			
 			// Init C++ library
@@ -1155,6 +1301,88 @@ namespace NativeScript
 		{
 			return ObjectStore.Store(((IEnumerable)ObjectStore.Get(handle)).GetEnumerator());
 		}
+		
+		// Bytes between elements of an array of the given type, as C++ will
+		// see them. Marshal.SizeOf gives the marshaled size instead, which
+		// is 1 for char and throws for enums, so measure a pinned pair.
+		static readonly System.Collections.Generic.Dictionary<Type, int> arrayElementSizes =
+			new System.Collections.Generic.Dictionary<Type, int>();
+		
+		static int GetArrayElementSize(Type elementType)
+		{
+			int size;
+			if (!arrayElementSizes.TryGetValue(elementType, out size))
+			{
+				Array pair = Array.CreateInstance(elementType, 2);
+				GCHandle pin = GCHandle.Alloc(pair, GCHandleType.Pinned);
+				try
+				{
+					size = (int)(
+						Marshal.UnsafeAddrOfPinnedArrayElement(pair, 1).ToInt64()
+						- Marshal.UnsafeAddrOfPinnedArrayElement(pair, 0).ToInt64());
+				}
+				finally
+				{
+					pin.Free();
+				}
+				arrayElementSizes[elementType] = size;
+			}
+			return size;
+		}
+		
+		// Pin an array so C++ can memcpy its elements. Returns the pin to
+		// pass to ArrayUnpin, or zero if the byte range is out of bounds.
+		[MonoPInvokeCallback(typeof(ArrayPinDelegateType))]
+		static IntPtr ArrayPin(
+			int handle,
+			int byteOffset,
+			int byteCount,
+			ref IntPtr address)
+		{
+			address = IntPtr.Zero;
+			try
+			{
+				Array array = (Array)ObjectStore.Get(handle);
+				long byteLength = (long)array.Length * GetArrayElementSize(
+					array.GetType().GetElementType());
+				if (byteOffset < 0
+					|| byteCount < 0
+					|| (long)byteOffset + byteCount > byteLength)
+				{
+					return IntPtr.Zero;
+				}
+				GCHandle pin = GCHandle.Alloc(array, GCHandleType.Pinned);
+				address = new IntPtr(
+					pin.AddrOfPinnedObject().ToInt64() + byteOffset);
+				return GCHandle.ToIntPtr(pin);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return IntPtr.Zero;
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return IntPtr.Zero;
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(ArrayUnpinDelegateType))]
+		static void ArrayUnpin(IntPtr pin)
+		{
+			try
+			{
+				GCHandle.FromIntPtr(pin).Free();
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+		}
 
 		/*BEGIN FUNCTIONS*/
 		[MonoPInvokeCallback(typeof(ReleaseSystemDecimalDelegateType))]
@@ -2719,103 +2947,97 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BaseGameScriptConstructorDelegateType))]
-		static void BaseGameScriptConstructor(int cppHandle, ref int handle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodRegisterArchetypeSystemInt32_SystemString_SystemInt32(int archetype, int nameHandle, int flags)
 		{
 			try
 			{
-				var thiz = new MyGame.BaseGameScript(cppHandle);
-				handle = NativeScript.Bindings.ObjectStore.Store(thiz);
+				var name = (string)NativeScript.Bindings.ObjectStore.Get(nameHandle);
+				MyGame.NativeBatch.RegisterArchetype(archetype, name, flags);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				handle = default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				handle = default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(ReleaseBaseGameScriptDelegateType))]
-		static void ReleaseBaseGameScript(int handle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodRegisterSpritesSystemIntPtr_SystemInt32(System.IntPtr handles, int count)
 		{
 			try
 			{
-				MyGame.BaseGameScript thiz;
-				thiz = (MyGame.BaseGameScript)ObjectStore.Get(handle);
-				int cppHandle = thiz.CppHandle;
-				thiz.CppHandle = 0;
-				QueueDestroy(DestroyFunction.BaseGameScript, cppHandle);
-				ObjectStore.Remove(handle);
+				var returnValue = MyGame.NativeBatch.RegisterSprites(handles, count);
+				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxBooleanDelegateType))]
-		static int BoxBoolean(bool val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodSetSpritesSystemIntPtr_SystemInt32(System.IntPtr commands, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
-				return returnValue;
+				MyGame.NativeBatch.SetSprites(commands, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxBooleanDelegateType))]
-		static bool UnboxBoolean(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodLoadSpriteSequenceSystemString_SystemInt32_SystemInt32(int formatHandle, int first, int count)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (bool)val;
+				var format = (string)NativeScript.Bindings.ObjectStore.Get(formatHandle);
+				var returnValue = MyGame.NativeBatch.LoadSpriteSequence(format, first, count);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(bool);
+				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(bool);
+				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxSByteDelegateType))]
-		static int BoxSByte(sbyte val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadSpritesSystemStringDelegateType))]
+		static int MyGameNativeBatchMethodLoadSpritesSystemString(int manifestHandle)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var manifest = (string)NativeScript.Bindings.ObjectStore.Get(manifestHandle);
+				var returnValue = MyGame.NativeBatch.LoadSprites(manifest);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -2832,35 +3054,36 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxSByteDelegateType))]
-		static sbyte UnboxSByte(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtrDelegateType))]
+		static int MyGameNativeBatchMethodLoadClipsSystemString_SystemIntPtr(int manifestHandle, System.IntPtr handles)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (sbyte)val;
+				var manifest = (string)NativeScript.Bindings.ObjectStore.Get(manifestHandle);
+				var returnValue = MyGame.NativeBatch.LoadClips(manifest, handles);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(sbyte);
+				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(sbyte);
+				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxByteDelegateType))]
-		static int BoxByte(byte val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodLoadSpriteSequenceAsyncSystemString_SystemInt32_SystemInt32(int formatHandle, int first, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var format = (string)NativeScript.Bindings.ObjectStore.Get(formatHandle);
+				var returnValue = MyGame.NativeBatch.LoadSpriteSequenceAsync(format, first, count);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -2877,35 +3100,36 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxByteDelegateType))]
-		static byte UnboxByte(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadSpritesAsyncSystemStringDelegateType))]
+		static int MyGameNativeBatchMethodLoadSpritesAsyncSystemString(int manifestHandle)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (byte)val;
+				var manifest = (string)NativeScript.Bindings.ObjectStore.Get(manifestHandle);
+				var returnValue = MyGame.NativeBatch.LoadSpritesAsync(manifest);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(byte);
+				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(byte);
+				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxInt16DelegateType))]
-		static int BoxInt16(short val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtrDelegateType))]
+		static int MyGameNativeBatchMethodLoadClipsAsyncSystemString_SystemIntPtr(int manifestHandle, System.IntPtr handles)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var manifest = (string)NativeScript.Bindings.ObjectStore.Get(manifestHandle);
+				var returnValue = MyGame.NativeBatch.LoadClipsAsync(manifest, handles);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -2922,170 +3146,148 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxInt16DelegateType))]
-		static short UnboxInt16(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodPollLoadsDelegateType))]
+		static float MyGameNativeBatchMethodPollLoads()
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (short)val;
+				var returnValue = MyGame.NativeBatch.PollLoads();
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(short);
+				return default(float);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(short);
+				return default(float);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxUInt16DelegateType))]
-		static int BoxUInt16(ushort val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodSetPositionsSystemIntPtr_SystemInt32(System.IntPtr commands, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
-				return returnValue;
+				MyGame.NativeBatch.SetPositions(commands, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxUInt16DelegateType))]
-		static ushort UnboxUInt16(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodGetSpriteBoundsSystemIntPtr_SystemInt32_SystemInt32(System.IntPtr bounds, int first, int count)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (ushort)val;
-				return returnValue;
+				MyGame.NativeBatch.GetSpriteBounds(bounds, first, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(ushort);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(ushort);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxInt32DelegateType))]
-		static int BoxInt32(int val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodSpawnSystemIntPtr_SystemInt32(System.IntPtr descriptors, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
-				return returnValue;
+				MyGame.NativeBatch.Spawn(descriptors, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxInt32DelegateType))]
-		static int UnboxInt32(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodDestroySystemIntPtr_SystemInt32(System.IntPtr slots, int count)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (int)val;
-				return returnValue;
+				MyGame.NativeBatch.Destroy(slots, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxUInt32DelegateType))]
-		static int BoxUInt32(uint val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodPlayOneShotsSystemIntPtr_SystemInt32(System.IntPtr commands, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
-				return returnValue;
+				MyGame.NativeBatch.PlayOneShots(commands, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxUInt32DelegateType))]
-		static uint UnboxUInt32(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodDestroyManySystemIntPtr_SystemInt32(System.IntPtr handles, int count)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (uint)val;
-				return returnValue;
+				MyGame.NativeBatch.DestroyMany(handles, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(uint);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(uint);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxInt64DelegateType))]
-		static int BoxInt64(long val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodGetSpriteUVsSystemIntPtr_SystemInt32_SystemInt32(System.IntPtr uvs, int first, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var returnValue = MyGame.NativeBatch.GetSpriteUVs(uvs, first, count);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -3102,35 +3304,33 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxInt64DelegateType))]
-		static long UnboxInt64(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodDrawSpritesSystemIntPtr_SystemInt32(System.IntPtr layers, int count)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (long)val;
-				return returnValue;
+				MyGame.NativeBatch.DrawSprites(layers, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(long);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(long);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxUInt64DelegateType))]
-		static int BoxUInt64(ulong val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodLoadAtlasAsyncSystemString_SystemString_SystemInt32_SystemInt32(int pathHandle, int formatHandle, int first, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var path = (string)NativeScript.Bindings.ObjectStore.Get(pathHandle);
+				var format = (string)NativeScript.Bindings.ObjectStore.Get(formatHandle);
+				var returnValue = MyGame.NativeBatch.LoadAtlasAsync(path, format, first, count);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -3147,80 +3347,72 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxUInt64DelegateType))]
-		static ulong UnboxUInt64(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetViewRectSystemIntPtrDelegateType))]
+		static void MyGameNativeBatchMethodGetViewRectSystemIntPtr(System.IntPtr rect)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (ulong)val;
-				return returnValue;
+				MyGame.NativeBatch.GetViewRect(rect);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(ulong);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(ulong);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxCharDelegateType))]
-		static int BoxChar(char val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodGetClipLengthsSystemIntPtr_SystemIntPtr_SystemInt32(System.IntPtr handles, System.IntPtr lengths, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
-				return returnValue;
+				MyGame.NativeBatch.GetClipLengths(handles, lengths, count);
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxCharDelegateType))]
-		static char UnboxChar(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodGetSoundDirectorySystemIntPtr_SystemInt32(System.IntPtr buffer, int size)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (char)val;
+				var returnValue = MyGame.NativeBatch.GetSoundDirectory(buffer, size);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(char);
+				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(char);
+				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxSingleDelegateType))]
-		static int BoxSingle(float val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetOutputSampleRateDelegateType))]
+		static int MyGameNativeBatchMethodGetOutputSampleRate()
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var returnValue = MyGame.NativeBatch.GetOutputSampleRate();
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -3237,35 +3429,53 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxSingleDelegateType))]
-		static float UnboxSingle(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32DelegateType))]
+		static void MyGameNativeBatchMethodSetAudioStreamSystemIntPtr_SystemInt32(System.IntPtr ring, int frames)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (float)val;
+				MyGame.NativeBatch.SetAudioStream(ring, frames);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodGetPackPathSystemIntPtr_SystemInt32(System.IntPtr buffer, int size)
+		{
+			try
+			{
+				var returnValue = MyGame.NativeBatch.GetPackPath(buffer, size);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(float);
+				return default(int);
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(float);
+				return default(int);
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(BoxDoubleDelegateType))]
-		static int BoxDouble(double val)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodAddPackSpritesSystemIntPtr_SystemInt32_SystemInt32_SystemIntPtr_SystemInt32(System.IntPtr pixels, int width, int height, System.IntPtr frames, int count)
 		{
 			try
 			{
-				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				var returnValue = MyGame.NativeBatch.AddPackSprites(pixels, width, height, frames, count);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
@@ -3282,26 +3492,739 @@ namespace NativeScript
 			}
 		}
 		
-		[MonoPInvokeCallback(typeof(UnboxDoubleDelegateType))]
-		static double UnboxDouble(int valHandle)
+		[MonoPInvokeCallback(typeof(MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32DelegateType))]
+		static int MyGameNativeBatchMethodCreatePackClipSystemInt32_SystemInt32(int frames, int sampleRate)
 		{
 			try
 			{
-				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
-				var returnValue = (double)val;
+				var returnValue = MyGame.NativeBatch.CreatePackClip(frames, sampleRate);
 				return returnValue;
 			}
 			catch (System.NullReferenceException ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(double);
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BaseGameScriptConstructorDelegateType))]
+		static void BaseGameScriptConstructor(int cppHandle, ref int handle)
+		{
+			try
+			{
+				var thiz = new MyGame.BaseGameScript(cppHandle);
+				handle = NativeScript.Bindings.ObjectStore.Store(thiz);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				handle = default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				handle = default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(ReleaseBaseGameScriptDelegateType))]
+		static void ReleaseBaseGameScript(int handle)
+		{
+			try
+			{
+				MyGame.BaseGameScript thiz;
+				thiz = (MyGame.BaseGameScript)ObjectStore.Get(handle);
+				int cppHandle = thiz.CppHandle;
+				thiz.CppHandle = 0;
+				QueueDestroy(DestroyFunction.BaseGameScript, cppHandle);
+				ObjectStore.Remove(handle);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineDebugMethodLogWarningSystemObjectDelegateType))]
+		static void UnityEngineDebugMethodLogWarningSystemObject(int messageHandle)
+		{
+			try
+			{
+				var message = NativeScript.Bindings.ObjectStore.Get(messageHandle);
+				UnityEngine.Debug.LogWarning(message);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineDebugMethodLogErrorSystemObjectDelegateType))]
+		static void UnityEngineDebugMethodLogErrorSystemObject(int messageHandle)
+		{
+			try
+			{
+				var message = NativeScript.Bindings.ObjectStore.Get(messageHandle);
+				UnityEngine.Debug.LogError(message);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxBooleanDelegateType))]
+		static int BoxBoolean(bool val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxBooleanDelegateType))]
+		static bool UnboxBoolean(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (bool)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(bool);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(bool);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxSByteDelegateType))]
+		static int BoxSByte(sbyte val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxSByteDelegateType))]
+		static sbyte UnboxSByte(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (sbyte)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(sbyte);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(sbyte);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxByteDelegateType))]
+		static int BoxByte(byte val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxByteDelegateType))]
+		static byte UnboxByte(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (byte)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(byte);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(byte);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxInt16DelegateType))]
+		static int BoxInt16(short val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxInt16DelegateType))]
+		static short UnboxInt16(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (short)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(short);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(short);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxUInt16DelegateType))]
+		static int BoxUInt16(ushort val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxUInt16DelegateType))]
+		static ushort UnboxUInt16(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (ushort)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(ushort);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(ushort);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxInt32DelegateType))]
+		static int BoxInt32(int val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxInt32DelegateType))]
+		static int UnboxInt32(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (int)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxUInt32DelegateType))]
+		static int BoxUInt32(uint val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxUInt32DelegateType))]
+		static uint UnboxUInt32(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (uint)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(uint);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(uint);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxInt64DelegateType))]
+		static int BoxInt64(long val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxInt64DelegateType))]
+		static long UnboxInt64(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (long)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(long);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(long);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxUInt64DelegateType))]
+		static int BoxUInt64(ulong val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxUInt64DelegateType))]
+		static ulong UnboxUInt64(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (ulong)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(ulong);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(ulong);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxCharDelegateType))]
+		static int BoxChar(char val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxCharDelegateType))]
+		static char UnboxChar(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (char)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(char);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(char);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxSingleDelegateType))]
+		static int BoxSingle(float val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxSingleDelegateType))]
+		static float UnboxSingle(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (float)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(float);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(float);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxDoubleDelegateType))]
+		static int BoxDouble(double val)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxDoubleDelegateType))]
+		static double UnboxDouble(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = (double)val;
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(double);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(double);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemSystemSingleArray2Constructor2DelegateType))]
+		static int SystemSystemSingleArray2Constructor2(int length0, int length1)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store(new float[length0, length1]);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemSystemSingleArray2GetLength2DelegateType))]
+		static int SystemSystemSingleArray2GetLength2(int thisHandle, int dimension)
+		{
+			try
+			{
+				var thiz = (float[,])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var returnValue = thiz.GetLength(dimension);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemSingleArray2GetItem2DelegateType))]
+		static float SystemSingleArray2GetItem2(int thisHandle, int index0, int index1)
+		{
+			try
+			{
+				var thiz = (float[,])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var returnValue = thiz[index0, index1];
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(float);
+			}
+			catch (System.Exception ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				return default(float);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemSingleArray2SetItem2DelegateType))]
+		static void SystemSingleArray2SetItem2(int thisHandle, int index0, int index1, float item)
+		{
+			try
+			{
+				var thiz = (float[,])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				thiz[index0, index1] = item;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				UnityEngine.Debug.LogException(ex);
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
 			}
 			catch (System.Exception ex)
 			{
 				UnityEngine.Debug.LogException(ex);
 				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
-				return default(double);
 			}
 		}
 		/*END FUNCTIONS*/
@@ -1357,6 +1357,37 @@ namespace NativeScript.Editor
 			return true;
 		}
 		
+		// Types whose C# array elements can be memcpy'd to and from their
+		// C++ counterparts. bool is left out because C# stores it in one
+		// byte but System::Boolean is four.
+		static bool IsBlittableType(Type type)
+		{
+			if (type == typeof(bool) || type == typeof(decimal))
+			{
+				return false;
+			}
+			if (type.IsPrimitive || type.IsEnum)
+			{
+				return true;
+			}
+			if (!IsFullValueType(type))
+			{
+				return false;
+			}
+			const BindingFlags bindingFlags =
+				BindingFlags.Instance
+				| BindingFlags.NonPublic
+				| BindingFlags.Public;
+			foreach (FieldInfo field in type.GetFields(bindingFlags))
+			{
+				if (!IsBlittableType(field.FieldType))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		
 		static int ArrayIndexOf<T>(T[] array, T value)
 		{
 			return array != null ?
@@ -1654,9 +1685,9 @@ namespace NativeScript.Editor
 				builders.CppGlobalStateAndFunctions.Append(");\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\tif (handle != 0)\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t{\n");
-				builders.CppGlobalStateAndFunctions.Append("\t\t\tRefCounts");
+				builders.CppGlobalStateAndFunctions.Append("\t\t\tIncrementRefCount(&RefCounts");
 				builders.CppGlobalStateAndFunctions.Append(funcNameSuffix);
-				builders.CppGlobalStateAndFunctions.Append("[handle]++;\n");
+				builders.CppGlobalStateAndFunctions.Append("[handle]);\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t}\n");
 				builders.CppGlobalStateAndFunctions.Append("\t}\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\n");
@@ -1669,14 +1700,16 @@ namespace NativeScript.Editor
 				builders.CppGlobalStateAndFunctions.Append(");\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\tif (handle != 0)\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t{\n");
-				builders.CppGlobalStateAndFunctions.Append("\t\t\tint32_t numRemain = --RefCounts");
+				builders.CppGlobalStateAndFunctions.Append("\t\t\tint32_t numRemain = DecrementRefCount(&RefCounts");
 				builders.CppGlobalStateAndFunctions.Append(funcNameSuffix);
-				builders.CppGlobalStateAndFunctions.Append("[handle];\n");
+				builders.CppGlobalStateAndFunctions.Append("[handle]);\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t\tif (numRemain == 0)\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t\t{\n");
-				builders.CppGlobalStateAndFunctions.Append("\t\t\t\tRelease");
+				builders.CppGlobalStateAndFunctions.Append("\t\t\t\tReleaseManaged(&RefCounts");
 				builders.CppGlobalStateAndFunctions.Append(funcNameSuffix);
-				builders.CppGlobalStateAndFunctions.Append("(handle);\n");
+				builders.CppGlobalStateAndFunctions.Append("[handle], Release");
+				builders.CppGlobalStateAndFunctions.Append(funcNameSuffix);
+				builders.CppGlobalStateAndFunctions.Append(", handle);\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t\t}\n");
 				builders.CppGlobalStateAndFunctions.Append("\t\t}\n");
 				builders.CppGlobalStateAndFunctions.Append("\t}\n\t\n");
@@ -2530,6 +2563,9 @@ namespace NativeScript.Editor
 				indent,
 				builders.CppMethodDefinitions);
 			builders.CppMethodDefinitions.Append("{\n");
+			AppendCppMainThreadCheck(
+				indent + 1,
+				builders.CppMethodDefinitions);
 			AppendIndent(
 				indent + 1,
 				builders.CppMethodDefinitions);
@@ -2635,6 +2671,9 @@ namespace NativeScript.Editor
 				indent,
 				output);
 			output.Append("{\n");
+			AppendCppMainThreadCheck(
+				indent + 1,
+				output);
 			AppendIndent(
 				indent + 1,
 				output);
@@ -4604,6 +4643,18 @@ namespace NativeScript.Editor
 					cppElementProxyTypeName,
 					builders.CppMethodDefinitions);
 				
+				// Bulk copies for element types with the same layout in C#
+				// and C++
+				if (IsBlittableType(elementType))
+				{
+					AppendArrayCopyFunctions(
+						elementType,
+						indent,
+						cppMethodDefinitionsIndent,
+						GetTypeName(cppGenericArrayTypeName, "System"),
+						builders);
+				}
+				
 				// C++ type definition (end)
 				AppendCppTypeDefinitionEnd(
 					false,
@@ -4627,6 +4678,102 @@ namespace NativeScript.Editor
 			}
 		}
 		
+		static void AppendArrayCopyFunctions(
+			Type elementType,
+			int indent,
+			int cppMethodDefinitionsIndent,
+			TypeName enclosingTypeTypeName,
+			StringBuilders builders)
+		{
+			builders.TempStrBuilder.Length = 0;
+			AppendCppTypeFullName(
+				elementType,
+				builders.TempStrBuilder);
+			string cppElementTypeName = builders.TempStrBuilder.ToString();
+			
+			AppendArrayCopyFunction(
+				"CopyTo",
+				cppElementTypeName + "* destination",
+				"destination",
+				cppElementTypeName,
+				indent,
+				cppMethodDefinitionsIndent,
+				enclosingTypeTypeName,
+				builders);
+			AppendArrayCopyFunction(
+				"CopyFrom",
+				"const " + cppElementTypeName + "* source",
+				"source",
+				cppElementTypeName,
+				indent,
+				cppMethodDefinitionsIndent,
+				enclosingTypeTypeName,
+				builders);
+		}
+		
+		static void AppendArrayCopyFunction(
+			string methodName,
+			string bufferParamDeclaration,
+			string bufferParamName,
+			string cppElementTypeName,
+			int indent,
+			int cppMethodDefinitionsIndent,
+			TypeName enclosingTypeTypeName,
+			StringBuilders builders)
+		{
+			// C++ method declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append("void ");
+			builders.CppTypeDefinitions.Append(methodName);
+			builders.CppTypeDefinitions.Append('(');
+			builders.CppTypeDefinitions.Append(bufferParamDeclaration);
+			builders.CppTypeDefinitions.Append(
+				", int32_t start, int32_t count);\n");
+			
+			// C++ method definition
+			StringBuilder output = builders.CppMethodDefinitions;
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				output);
+			output.Append("void ");
+			output.Append(enclosingTypeTypeName.Namespace);
+			output.Append("::");
+			AppendTypeNameWithoutGenericSuffix(
+				enclosingTypeTypeName.Name,
+				output);
+			output.Append("::");
+			output.Append(methodName);
+			output.Append('(');
+			output.Append(bufferParamDeclaration);
+			output.Append(", int32_t start, int32_t count)\n");
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				output);
+			output.Append("{\n");
+			AppendIndent(
+				cppMethodDefinitionsIndent + 1,
+				output);
+			output.Append("Array::");
+			output.Append(methodName);
+			output.Append("Raw(");
+			output.Append(bufferParamName);
+			output.Append(", start * (int32_t)sizeof(");
+			output.Append(cppElementTypeName);
+			output.Append("), count * (int32_t)sizeof(");
+			output.Append(cppElementTypeName);
+			output.Append("));\n");
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				output);
+			output.Append("}\n");
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				output);
+			output.Append('\n');
+		}
+		
 		static void AppendArrayIterator(
 			Type elementType,
 			string cppGenericArrayTypeName,
@@ -5231,10 +5378,15 @@ namespace NativeScript.Editor
 				builders.CppTypeDefinitions.Append(i);
 				builders.CppTypeDefinitions.Append(";\n");
 			}
+			// The constructor is named without the template arguments. C++20
+			// doesn't allow them there.
 			AppendIndent(
 				indent + 1,
 				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.Append(cppElementProxyTypeName);
+			builders.CppTypeDefinitions.Append("ArrayElementProxy");
+			builders.CppTypeDefinitions.Append(rank);
+			builders.CppTypeDefinitions.Append('_');
+			builders.CppTypeDefinitions.Append(maxRank);
 			builders.CppTypeDefinitions.Append(
 				"(Plugin::InternalUse, int32_t handle, ");
 			for (int i = 0; i < rank; ++i)
@@ -6616,6 +6768,9 @@ namespace NativeScript.Editor
 				indent,
 				builders.CppMethodDefinitions);
 			builders.CppMethodDefinitions.Append("{\n");
+			AppendCppMainThreadCheck(
+				indent + 1,
+				builders.CppMethodDefinitions);
 			AppendIndent(
 				indent + 1,
 				builders.CppMethodDefinitions);
@@ -6648,6 +6803,9 @@ namespace NativeScript.Editor
 				indent,
 				builders.CppMethodDefinitions);
 			builders.CppMethodDefinitions.Append("{\n");
+			AppendCppMainThreadCheck(
+				indent + 1,
+				builders.CppMethodDefinitions);
 			AppendIndent(
 				indent + 1,
 				builders.CppMethodDefinitions);
@@ -9402,9 +9560,6 @@ namespace NativeScript.Editor
 			AppendCppTypeName(
 				typeTypeName,
 				output);
-			AppendCppTypeParameters(
-				typeIsDelegate ? typeParams : null,
-				output);
 			output.Append("()\n");
 			AppendIndent(
 				cppMethodDefinitionsIndent,
@@ -11235,14 +11390,12 @@ namespace NativeScript.Editor
 				{
 					case TypeKind.Class:
 					case TypeKind.ManagedStruct:
-						// Constructor from nullptr
+						// Constructor from nullptr. Declared by the plain
+						// name, C++20 doesn't allow a template-id here
 						AppendIndent(indent + 1, output);
 						AppendCppTypeName(
 							typeTypeName,
 							output);
-						AppendCppTypeParameters(
-							typeParams,
-							output);
 						output.Append("(decltype(nullptr));\n");
 						
 						// Constructor from handle
@@ -11250,9 +11403,6 @@ namespace NativeScript.Editor
 						AppendCppTypeName(
 							typeTypeName,
 							output);
-						AppendCppTypeParameters(
-							typeParams,
-							output);
 						output.Append(
 							"(Plugin::InternalUse, int32_t handle);\n");
 						
@@ -11261,9 +11411,6 @@ namespace NativeScript.Editor
 						AppendCppTypeName(
 							typeTypeName,
 							output);
-						AppendCppTypeParameters(
-							typeParams,
-							output);
 						output.Append("(const ");
 						AppendCppTypeName(
 							typeTypeName,
@@ -11278,9 +11425,6 @@ namespace NativeScript.Editor
 						AppendCppTypeName(
 							typeTypeName,
 							output);
-						AppendCppTypeParameters(
-							typeParams,
-							output);
 						output.Append('(');
 						AppendCppTypeName(
 							typeTypeName,
@@ -11296,9 +11440,6 @@ namespace NativeScript.Editor
 						AppendCppTypeName(
 							typeTypeName,
 							output);
-						AppendCppTypeParameters(
-							typeParams,
-							output);
 						output.Append("();\n");
 						
 						// Assignment operator to same type
@@ -11564,9 +11705,6 @@ namespace NativeScript.Editor
 				AppendCppTypeName(
 					enclosingTypeTypeName,
 					output);
-				AppendCppTypeParameters(
-					enclosingTypeParams,
-					output);
 				output.Append("()\n");
 				AppendIndent(indent, output);
 				output.Append("{\n");
@@ -12690,6 +12828,7 @@ namespace NativeScript.Editor
 			}
 			
 			// Call the function
+			AppendCppMainThreadCheck(indent, output);
 			AppendIndent(indent, output);
 			if (returnType != null && returnType != typeof(void))
 			{
@@ -12778,6 +12917,14 @@ namespace NativeScript.Editor
 			}
 		}
 		
+		static void AppendCppMainThreadCheck(
+			int indent,
+			StringBuilder output)
+		{
+			AppendIndent(indent, output);
+			output.Append("NATIVE_SCRIPT_ASSERT_MAIN_THREAD();\n");
+		}
+		
 		static void AppendCppUnhandledExceptionHandling(
 			int indent,
 			StringBuilder output)